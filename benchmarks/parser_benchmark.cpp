@@ -0,0 +1,462 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "parsers.hpp"
+
+namespace oct_args_benchmarks
+{
+namespace
+{
+
+using string_vector = std::vector<std::string>;
+
+void set_items_processed(benchmark::State& state, std::size_t items_per_iteration)
+{
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * items_per_iteration));
+}
+
+void parse_switches(benchmark::State& state)
+{
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    auto parser = make_switches_parser(count);
+
+    string_vector args;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        args.push_back(make_name("--switch", i));
+    }
+    oct::args::argument_table arg_table("app", args);
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse(arg_table);
+        benchmark::DoNotOptimize(results);
+    }
+    set_items_processed(state, args.size());
+}
+BENCHMARK(parse_switches)->Arg(8)->Arg(64)->Arg(512);
+
+void parse_switches_compiled(benchmark::State& state)
+{
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    auto parser = make_switches_parser(count).compile();
+
+    string_vector args;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        args.push_back(make_name("--switch", i));
+    }
+    oct::args::argument_table arg_table("app", args);
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse(arg_table);
+        benchmark::DoNotOptimize(results);
+    }
+    set_items_processed(state, args.size());
+}
+BENCHMARK(parse_switches_compiled)->Arg(8)->Arg(64)->Arg(512);
+
+// argument is the number of switches defined, only one of them is used
+void parse_single_switch(benchmark::State& state)
+{
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    auto parser = make_switches_parser(count);
+
+    oct::args::argument_table arg_table("app", { make_name("--switch", 0) });
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse(arg_table);
+        benchmark::DoNotOptimize(results);
+    }
+    set_items_processed(state, 1);
+}
+BENCHMARK(parse_single_switch)->Arg(8)->Arg(64)->Arg(512);
+
+void parse_positionals(benchmark::State& state)
+{
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    auto parser = make_calc_parser();
+
+    string_vector args { "--operation=max", "-t", "int", "--steps" };
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        args.push_back(std::to_string(i));
+    }
+    oct::args::argument_table arg_table("app", args);
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse(arg_table);
+        benchmark::DoNotOptimize(results);
+    }
+    set_items_processed(state, args.size());
+}
+BENCHMARK(parse_positionals)->Arg(16)->Arg(1024)->Arg(100000);
+
+void parse_positionals_range(benchmark::State& state)
+{
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    oct::args::parser parser;
+    parser.add_switch({ "-v", "--verbose" });
+    parser.add_positional("FILES").set_max_count_unlimited().set_values_as_range();
+
+    string_vector args { "--verbose" };
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        args.push_back(std::to_string(i) + ".log");
+    }
+    oct::args::argument_table arg_table("app", args);
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse(arg_table);
+        auto range = results.get_values_range("FILES");
+        benchmark::DoNotOptimize(range);
+    }
+    set_items_processed(state, args.size());
+}
+BENCHMARK(parse_positionals_range)->Arg(16)->Arg(1024)->Arg(1000000);
+
+void parse_argv_positionals(benchmark::State& state)
+{
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    auto parser = make_calc_parser();
+
+    string_vector args { "app", "--operation=max", "-t", "int", "--steps" };
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        args.push_back(std::to_string(i));
+    }
+
+    std::vector<const char*> argv;
+    for (auto& arg : args)
+    {
+        argv.push_back(arg.c_str());
+    }
+    argv.push_back(nullptr);
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse(static_cast<int>(args.size()), argv.data());
+        benchmark::DoNotOptimize(results);
+    }
+    set_items_processed(state, args.size());
+}
+BENCHMARK(parse_argv_positionals)->Arg(16)->Arg(1024)->Arg(100000);
+
+void parse_argv_positionals_context(benchmark::State& state)
+{
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    auto parser = make_calc_parser();
+
+    string_vector args { "app", "--operation=max", "-t", "int", "--steps" };
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        args.push_back(std::to_string(i));
+    }
+
+    std::vector<const char*> argv;
+    for (auto& arg : args)
+    {
+        argv.push_back(arg.c_str());
+    }
+    argv.push_back(nullptr);
+
+    oct::args::parse_context context;
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse(static_cast<int>(args.size()), argv.data(), context);
+        benchmark::DoNotOptimize(results);
+    }
+    set_items_processed(state, args.size());
+}
+BENCHMARK(parse_argv_positionals_context)->Arg(16)->Arg(1024)->Arg(100000);
+
+class counting_visitor : public oct::args::parse_visitor
+{
+public:
+    void on_value(const oct::args::argument_handle& /*argument*/, string_view_type value,
+        std::size_t /*arg_index*/) override
+    {
+        m_total_size += value.size();
+    }
+
+    std::size_t m_total_size = 0;
+};
+
+void visit_positionals(benchmark::State& state)
+{
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    auto parser = make_calc_parser();
+
+    string_vector args { "--operation=max", "-t", "int", "--steps" };
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        args.push_back(std::to_string(i));
+    }
+    oct::args::argument_table arg_table("app", args);
+
+    for (auto _ : state)
+    {
+        counting_visitor visitor;
+        parser.visit(arg_table, visitor);
+        benchmark::DoNotOptimize(visitor.m_total_size);
+    }
+    set_items_processed(state, args.size());
+}
+BENCHMARK(visit_positionals)->Arg(16)->Arg(1024)->Arg(100000);
+
+void parse_getfile(benchmark::State& state)
+{
+    auto parser = make_getfile_parser();
+
+    oct::args::argument_table file_arg_table("app", { "-v", "file", "--path=/tmp/file.txt" });
+    oct::args::argument_table http_arg_table(
+        "app", { "--verbose", "http", "-h", "localhost", "--port=8080", "--path", "/index.html" });
+
+    for (auto _ : state)
+    {
+        auto file_results = parser.parse(file_arg_table);
+        benchmark::DoNotOptimize(file_results);
+
+        auto http_results = parser.parse(http_arg_table);
+        benchmark::DoNotOptimize(http_results);
+    }
+    set_items_processed(state, 2);
+}
+BENCHMARK(parse_getfile);
+
+// same as parse_getfile but only validates the arguments (no results)
+void validate_getfile(benchmark::State& state)
+{
+    auto parser = make_getfile_parser();
+
+    oct::args::argument_table file_arg_table("app", { "-v", "file", "--path=/tmp/file.txt" });
+    oct::args::argument_table http_arg_table(
+        "app", { "--verbose", "http", "-h", "localhost", "--port=8080", "--path", "/index.html" });
+
+    for (auto _ : state)
+    {
+        auto file_result = parser.validate(file_arg_table);
+        benchmark::DoNotOptimize(file_result);
+
+        auto http_result = parser.validate(http_arg_table);
+        benchmark::DoNotOptimize(http_result);
+    }
+    set_items_processed(state, 2);
+}
+BENCHMARK(validate_getfile);
+
+// argument is the thread count, compare items per second to see the scaling
+void parse_batch_getfile(benchmark::State& state)
+{
+    auto thread_count = static_cast<std::size_t>(state.range(0));
+    const std::size_t table_count = 16384;
+
+    auto parser = make_getfile_parser().compile();
+
+    std::vector<oct::args::argument_table> arg_tables;
+    string_vector file_args { "-v", "file", "--path=/tmp/file.txt" };
+    string_vector http_args { "--verbose", "http", "-h", "localhost", "--port=8080", "--path", "/index.html" };
+    for (std::size_t i = 0; i < table_count; ++i)
+    {
+        arg_tables.emplace_back("app", (i % 2) ? http_args : file_args);
+    }
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse_batch(arg_tables, thread_count);
+        benchmark::DoNotOptimize(results);
+    }
+    set_items_processed(state, table_count);
+}
+BENCHMARK(parse_batch_getfile)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+
+void parse_nested_subparsers(benchmark::State& state)
+{
+    auto depth = static_cast<std::size_t>(state.range(0));
+
+    auto parser = make_nested_subparsers_parser(depth);
+
+    string_vector args;
+    for (std::size_t i = 0; i < depth; ++i)
+    {
+        args.push_back("--verbose");
+        args.push_back("--level=" + std::to_string(i));
+        args.push_back(make_name("cmd", i));
+    }
+    args.push_back("value");
+    oct::args::argument_table arg_table("app", args);
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse(arg_table);
+        benchmark::DoNotOptimize(results);
+    }
+    set_items_processed(state, args.size());
+}
+BENCHMARK(parse_nested_subparsers)->Arg(1)->Arg(4)->Arg(16);
+
+void parse_many_subcommands(benchmark::State& state)
+{
+    auto subcommand_count = static_cast<std::size_t>(state.range(0));
+
+    auto parser = make_subcommands_parser(subcommand_count, 8);
+
+    oct::args::argument_table arg_table("app", { "-v", "cmd0", "--option0=a", "--option1", "b" });
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse(arg_table);
+        benchmark::DoNotOptimize(results);
+    }
+    set_items_processed(state, 5);
+}
+BENCHMARK(parse_many_subcommands)->Arg(4)->Arg(40);
+
+void parse_case_insensitive(benchmark::State& state)
+{
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    auto parser = make_case_insensitive_parser(count);
+
+    string_vector args;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        args.push_back(make_name("--OPTION", i) + "=bEtA");
+    }
+    oct::args::argument_table arg_table("app", args);
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse(arg_table);
+        benchmark::DoNotOptimize(results);
+    }
+    set_items_processed(state, args.size());
+}
+BENCHMARK(parse_case_insensitive)->Arg(8)->Arg(64)->Arg(512);
+
+// argument is the number of allowed values
+void parse_allowed_values(benchmark::State& state)
+{
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    string_vector allowed_values;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        allowed_values.push_back(make_name("instance-type-", i));
+    }
+
+    oct::args::parser parser;
+    parser.add_positional("TYPES").set_max_count_unlimited().set_allowed_values(allowed_values);
+
+    string_vector args;
+    for (std::size_t i = 0; i < 64; ++i)
+    {
+        args.push_back(allowed_values[(i * 7919) % count]);
+    }
+    oct::args::argument_table arg_table("app", args);
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse(arg_table);
+        benchmark::DoNotOptimize(results);
+    }
+    set_items_processed(state, args.size());
+}
+BENCHMARK(parse_allowed_values)->Arg(4)->Arg(64)->Arg(512);
+
+// argument is the number of typed arguments with default values (none given in the command line)
+void parse_default_values(benchmark::State& state)
+{
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    oct::args::parser parser;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        parser.add_valued({ make_name("--option", i) }).set_type<double>().set_default_value(std::to_string(i) + ".5");
+    }
+
+    oct::args::argument_table arg_table("app", {});
+
+    for (auto _ : state)
+    {
+        auto results = parser.parse(arg_table);
+        benchmark::DoNotOptimize(results);
+    }
+    set_items_processed(state, count);
+}
+BENCHMARK(parse_default_values)->Arg(8)->Arg(64);
+
+void parse_typed_storage(benchmark::State& state)
+{
+    auto count = static_cast<std::size_t>(state.range(0));
+
+    auto parser = make_storing_parser();
+
+    string_vector args { "--verbose", "--level=7", "-r", "0.25" };
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        args.push_back(std::to_string(i * 1000003));
+    }
+    oct::args::argument_table arg_table("app", args);
+
+    for (auto _ : state)
+    {
+        typed_settings settings;
+        auto results = parser.parse(arg_table, settings);
+        benchmark::DoNotOptimize(results);
+        benchmark::DoNotOptimize(settings);
+    }
+    set_items_processed(state, args.size());
+}
+BENCHMARK(parse_typed_storage)->Arg(16)->Arg(1024)->Arg(100000);
+
+void results_get_values_as(benchmark::State& state)
+{
+    oct::args::parser parser;
+    parser.add_valued({ "-l", "--level" }).set_type<int>();
+    parser.add_valued({ "-r", "--ratio" }).set_type<double>();
+
+    auto results = parser.parse(oct::args::argument_table("app", { "--level=7", "-r", "0.25" }));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(results.get_first_value_as<int>("--level"));
+        benchmark::DoNotOptimize(results.get_first_value_as<double>("-r"));
+    }
+    set_items_processed(state, 2);
+}
+BENCHMARK(results_get_values_as);
+
+void results_get_bool_values(benchmark::State& state)
+{
+    oct::args::parser parser;
+    parser.add_valued({ "--flag" }).set_max_count_unlimited();
+
+    auto results
+        = parser.parse(oct::args::argument_table("app", { "--flag=yes", "--flag=false", "--flag=1", "--flag=no" }));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(results.get_values_as<bool>("--flag"));
+    }
+    set_items_processed(state, 4);
+}
+BENCHMARK(results_get_bool_values);
+
+} // namespace
+} // namespace oct_args_benchmarks
@@ -0,0 +1,170 @@
+#ifndef OCTARGS_BENCHMARKS_PARSERS_HPP_
+#define OCTARGS_BENCHMARKS_PARSERS_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "octargs/octargs.hpp"
+
+namespace oct_args_benchmarks
+{
+
+inline std::string make_name(const std::string& prefix, std::size_t index)
+{
+    return prefix + std::to_string(index);
+}
+
+/// Parser with given number of switches (--switch0, --switch1, ...).
+inline oct::args::parser make_switches_parser(std::size_t count)
+{
+    oct::args::parser parser;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        parser.add_switch({ make_name("--switch", i) }).set_description("switch description");
+    }
+    return parser;
+}
+
+/// Parser similar to the calc example (named arguments + unlimited operands).
+inline oct::args::parser make_calc_parser()
+{
+    oct::args::parser parser;
+    parser.set_usage_oneliner("Simple calculator application");
+    parser.set_usage_header("Performs requested operation on given values.");
+
+    parser.add_exclusive({ "--help" }).set_description("display this help and exit");
+    parser.add_valued({ "-o", "--oper", "--operation" })
+        .set_description("operation to perform")
+        .set_min_count(1)
+        .set_allowed_values({ "sum", "mul", "min", "max" })
+        .set_default_value("sum");
+    parser.add_valued({ "-t", "--type" })
+        .set_description("operand type")
+        .set_min_count(1)
+        .set_allowed_values({ "int", "float", "double" })
+        .set_default_value("int");
+    parser.add_positional("OPERANDS")
+        .set_description("values on which operations will be performed")
+        .set_min_count(1)
+        .set_max_count_unlimited();
+
+    auto output_group = parser.add_group("Output arguments");
+    output_group.add_switch({ "-s", "--steps" }).set_description("show output of steps");
+
+    return parser;
+}
+
+/// Parser similar to the getfile example (protocol subparsers).
+inline oct::args::parser make_getfile_parser()
+{
+    oct::args::parser parser;
+    parser.set_usage_oneliner("Read file using different protocols");
+
+    parser.add_exclusive({ "--help" }).set_description("shows usage information");
+    parser.add_switch({ "-v", "--verbose" }).set_description("print verbose information");
+
+    auto subparsers = parser.add_subparsers("PROTOCOL").set_description("Protocol to use to get the file");
+
+    auto file_parser = subparsers.add_parser("file");
+    file_parser.add_exclusive({ "--help" }).set_description("shows usage information");
+    file_parser.add_valued({ "-p", "--path" }).set_description("path to file to get").set_min_count(1);
+
+    auto http_parser = subparsers.add_parser("http");
+    http_parser.add_exclusive({ "--help" }).set_description("shows usage information");
+    http_parser.add_valued({ "-h", "--host" }).set_description("address of host").set_min_count(1);
+    http_parser.add_valued({ "-t", "--port" }).set_description("port of host").set_default_value("80");
+    http_parser.add_valued({ "-p", "--path" }).set_description("path to file to get").set_min_count(1);
+
+    return parser;
+}
+
+/// Parser with chain of nested subparsers (cmd0 cmd1 ... cmdN-1).
+inline oct::args::parser make_nested_subparsers_parser(std::size_t depth)
+{
+    oct::args::parser root_parser;
+
+    auto parser = root_parser;
+    for (std::size_t i = 0; i < depth; ++i)
+    {
+        parser.add_switch({ "-v", "--verbose" });
+        parser.add_valued({ "-l", "--level" }).set_default_value("0");
+
+        auto subparsers = parser.add_subparsers(make_name("COMMAND", i));
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+            subparsers.add_parser(make_name("other", j)).add_switch({ "--dummy" });
+        }
+        parser = subparsers.add_parser(make_name("cmd", i));
+    }
+    parser.add_positional("VALUES").set_max_count_unlimited();
+
+    return root_parser;
+}
+
+/// Parser with given number of subcommands, each with the given number of options.
+inline oct::args::parser make_subcommands_parser(std::size_t subcommand_count, std::size_t option_count)
+{
+    oct::args::parser parser;
+    parser.add_switch({ "-v", "--verbose" });
+
+    auto subparsers = parser.add_subparsers("COMMAND");
+    for (std::size_t i = 0; i < subcommand_count; ++i)
+    {
+        auto subparser = subparsers.add_parser(make_name("cmd", i));
+        for (std::size_t j = 0; j < option_count; ++j)
+        {
+            subparser.add_valued({ make_name("--option", j) });
+        }
+    }
+    return parser;
+}
+
+/// Parser with given number of valued arguments using case insensitive dictionary.
+inline oct::args::parser make_case_insensitive_parser(std::size_t count)
+{
+    using dictionary_type = oct::args::custom_dictionary<char>;
+
+    auto dictionary = std::make_shared<dictionary_type>(dictionary_type::init_mode::WITH_DEFAULTS);
+    dictionary->set_case_sensitive(false);
+
+    oct::args::parser parser(dictionary);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        parser.add_valued({ make_name("--Option", i) }).set_allowed_values({ "Alpha", "Beta", "Gamma" });
+    }
+    return parser;
+}
+
+struct typed_settings
+{
+    typed_settings()
+        : m_verbose(false)
+        , m_level(0)
+        , m_ratio(0.0)
+        , m_values()
+    {
+        // noop
+    }
+
+    bool m_verbose;
+    int m_level;
+    double m_ratio;
+    std::vector<std::int64_t> m_values;
+};
+
+/// Parser converting and storing values in typed_settings.
+inline oct::args::storing_parser<typed_settings> make_storing_parser()
+{
+    oct::args::storing_parser<typed_settings> parser;
+    parser.add_switch({ "-v", "--verbose" }).set_type_and_storage(&typed_settings::m_verbose);
+    parser.add_valued({ "-l", "--level" }).set_type_and_storage(&typed_settings::m_level);
+    parser.add_valued({ "-r", "--ratio" }).set_type_and_storage(&typed_settings::m_ratio);
+    parser.add_positional("VALUES").set_max_count_unlimited().set_type_and_storage(&typed_settings::m_values);
+    return parser;
+}
+
+} // namespace oct_args_benchmarks
+
+#endif // OCTARGS_BENCHMARKS_PARSERS_HPP_
@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+
+#include "parsers.hpp"
+
+namespace oct_args_benchmarks
+{
+namespace
+{
+
+template <typename parser_T>
+void print_usage(benchmark::State& state, const parser_T& parser)
+{
+    for (auto _ : state)
+    {
+        std::ostringstream os;
+        os << parser.get_usage();
+        benchmark::DoNotOptimize(os.str());
+    }
+}
+
+void usage_calc(benchmark::State& state)
+{
+    print_usage(state, make_calc_parser());
+}
+BENCHMARK(usage_calc);
+
+void usage_getfile(benchmark::State& state)
+{
+    print_usage(state, make_getfile_parser());
+}
+BENCHMARK(usage_getfile);
+
+void usage_switches(benchmark::State& state)
+{
+    print_usage(state, make_switches_parser(static_cast<std::size_t>(state.range(0))));
+}
+BENCHMARK(usage_switches)->Arg(8)->Arg(64)->Arg(512);
+
+} // namespace
+} // namespace oct_args_benchmarks
@@ -47,7 +47,7 @@ struct cat_app_settings
     bool m_help_requested;
     bool m_print_line_ends;
     bool m_print_line_numbers;
-    std::vector<std::string> m_input_names;
+    oct::args::values_range m_input_names;
 };
 
 class cat_app_engine
@@ -72,7 +72,7 @@ public:
             }
             else
             {
-                cat_file(input_name);
+                cat_file(input_name.to_string());
             }
         }
     }
@@ -163,15 +163,17 @@ public:
                 .set_description("number all output lines")
                 .set_type_and_storage(&cat_app_settings::m_print_line_numbers);
 
+            // files are not copied, results reference the input arguments
             arg_parser.add_positional("FILES")
                 .set_max_count_unlimited()
                 .set_default_value(STANDARD_INPUT_NAME)
                 .set_description("files to concatenate")
-                .set_type_and_storage(&cat_app_settings::m_input_names);
+                .set_values_as_range();
 
             cat_app_settings settings;
 
-            arg_parser.parse(m_input_args, settings);
+            auto results = arg_parser.parse(m_input_args, settings);
+            settings.m_input_names = results.get_values_range("FILES");
 
             if (settings.m_help_requested)
             {
@@ -75,19 +75,24 @@ public:
         return cast_this_to_derived();
     }
 
-    // cppcheck-suppress functionStatic
     derived_type& set_storage(data_type storage_helper_wrapped_type::*member_ptr)
     {
-        return set_store_function(
-            [member_ptr](values_storage_type& storage, const data_type& value) { storage.*member_ptr = value; });
+        if (!m_handler)
+        {
+            throw std::logic_error("Type (handler) not set");
+        }
+        m_handler->set_storage(member_ptr);
+        return cast_this_to_derived();
     }
 
-    // cppcheck-suppress functionStatic
     derived_type& set_storage(std::vector<data_type> storage_helper_wrapped_type::*member_ptr)
     {
-        return set_store_function([member_ptr](values_storage_type& storage, const data_type& value) {
-            (storage.*member_ptr).emplace_back(value);
-        });
+        if (!m_handler)
+        {
+            throw std::logic_error("Type (handler) not set");
+        }
+        m_handler->set_storage(member_ptr);
+        return cast_this_to_derived();
     }
 
 protected:
@@ -265,6 +270,7 @@ protected:
         using handler_type = typename new_derived_type::handler_type;
 
         auto handler = std::make_shared<handler_type>();
+        handler->set_tree_state(m_argument->get_tree_state());
 
         m_argument->set_handler(handler);
         this->reset_handler();
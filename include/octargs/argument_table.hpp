@@ -1,21 +1,54 @@
 #ifndef OCTARGS_ARGUMENT_TABLE_HPP_
 #define OCTARGS_ARGUMENT_TABLE_HPP_
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "exception.hpp"
+#include "string_view.hpp"
 
 namespace oct
 {
 namespace args
 {
 
+namespace internal
+{
+
+template <typename char_T>
+class response_files_expander;
+
+} // namespace internal
+
+/// \brief Tag type selecting argument table constructors borrowing argv
+struct borrow_arguments_t
+{
+};
+
+/// \brief Tag selecting argument table constructors borrowing argv
+///
+/// Example: basic_argument_table<char>(borrow_arguments, argc, argv).
+constexpr borrow_arguments_t borrow_arguments {};
+
 /// \brief Input arguments table
 ///
 /// Simple input arguments wrapper class encapsulating arguments given to
 /// to application (e.g. argc + argv passed to main function).
 ///
+/// Arguments are accessible as views. By default the table owns a shared
+/// copy of the arguments, so the results produced from it stay valid
+/// independently of the input. Table created with borrow_arguments tag does
+/// not copy the argv strings - they must stay alive (and unchanged) as long
+/// as the table or any results produced from it are used.
+///
+/// Response files (\@path arguments) could be expanded on request (see
+/// expand_response_files() in response_file.hpp).
+///
+/// Argument views are kept in a vector shared with the results referencing
+/// ranges of the arguments (see get_argument_views()), the table allocates
+/// a new vector when it is modified while shared.
+///
 /// \tparam char_T      char type (as in std::basic_string)
 template <typename char_T>
 class basic_argument_table
@@ -25,33 +58,87 @@ public:
 
     using string_type = std::basic_string<char_type>;
     using string_vector_type = std::vector<string_type>;
+    using string_view_type = basic_string_view<char_type>;
+    using string_view_vector_type = std::vector<string_view_type>;
+
+    using const_storage_ptr_type = std::shared_ptr<const string_vector_type>;
+    using const_argument_views_ptr_type = std::shared_ptr<const string_view_vector_type>;
+    using const_object_ptr_vector_type = std::vector<std::shared_ptr<const void>>;
 
     explicit basic_argument_table()
         : m_app_name()
-        , m_arguments()
+        , m_arguments_ptr(std::make_shared<string_view_vector_type>())
+        , m_storage_ptr()
+        , m_response_files()
     {
         // noop
     }
 
+    explicit basic_argument_table(int argc, const char_type* const argv[])
+        : basic_argument_table()
+    {
+        assign(argc, argv);
+    }
+
     explicit basic_argument_table(int argc, const char_type* argv[])
-        : m_app_name(argv[0])
-        , m_arguments(&argv[1], &argv[argc])
+        : basic_argument_table()
     {
-        // noop
+        assign(argc, argv);
     }
 
     explicit basic_argument_table(int argc, char_type* argv[])
+        : basic_argument_table()
+    {
+        assign(argc, argv);
+    }
+
+    explicit basic_argument_table(borrow_arguments_t, int argc, const char_type* const argv[])
         : m_app_name(argv[0])
-        , m_arguments(&argv[1], &argv[argc])
+        , m_arguments_ptr(std::make_shared<string_view_vector_type>(&argv[1], &argv[argc]))
+        , m_storage_ptr()
+        , m_response_files()
     {
         // noop
     }
 
     explicit basic_argument_table(const string_type& app_name, const string_vector_type& arguments)
         : m_app_name(app_name)
-        , m_arguments(arguments)
+        , m_arguments_ptr()
+        , m_storage_ptr(std::make_shared<string_vector_type>(arguments))
+        , m_response_files()
     {
-        // noop
+        m_arguments_ptr = std::make_shared<string_view_vector_type>(m_storage_ptr->begin(), m_storage_ptr->end());
+    }
+
+    /// \brief Replaces table contents with a copy of argc + argv arguments
+    ///
+    /// Memory already allocated by the table is reused (if not shared with
+    /// results).
+    void assign(int argc, const char_type* const argv[])
+    {
+        m_app_name.assign(argv[0]);
+
+        auto& storage = get_modifiable_storage();
+        storage.resize(static_cast<std::size_t>(argc - 1));
+        for (std::size_t i = 0; i < storage.size(); ++i)
+        {
+            storage[i].assign(argv[i + 1]);
+        }
+
+        get_modifiable_arguments().assign(storage.begin(), storage.end());
+        m_response_files.clear();
+    }
+
+    /// \brief Replaces table contents with borrowed argc + argv arguments
+    ///
+    /// Memory already allocated by the table is reused (if not shared with
+    /// results).
+    void assign(borrow_arguments_t, int argc, const char_type* const argv[])
+    {
+        m_app_name.assign(argv[0]);
+        get_modifiable_arguments().assign(&argv[1], &argv[argc]);
+        m_storage_ptr.reset();
+        m_response_files.clear();
     }
 
     const string_type& get_app_name() const
@@ -61,17 +148,69 @@ public:
 
     std::size_t get_argument_count() const
     {
-        return m_arguments.size();
+        return m_arguments_ptr->size();
+    }
+
+    /// \brief Returns copy of the argument
+    ///
+    /// Borrowed and response files arguments are not stored as strings, so
+    /// a copy is returned. Use get_argument_view() to avoid the copy.
+    string_type get_argument(std::size_t index) const
+    {
+        return get_argument_view(index).to_string();
     }
 
-    const string_type& get_argument(std::size_t index) const
+    /// \brief Returns view of the argument (valid as long as the table or its argument views are alive)
+    string_view_type get_argument_view(std::size_t index) const
     {
-        return m_arguments[index];
+        return (*m_arguments_ptr)[index];
+    }
+
+    /// \brief Returns vector of argument views (shared with the table)
+    ///
+    /// The vector stays unchanged as long as it is referenced.
+    const_argument_views_ptr_type get_argument_views() const
+    {
+        return m_arguments_ptr;
+    }
+
+    /// \brief Returns storage owning the arguments (null if arguments are borrowed)
+    const_storage_ptr_type get_storage() const
+    {
+        return m_storage_ptr;
+    }
+
+    /// \brief Returns objects owning contents of expanded response files
+    const const_object_ptr_vector_type& get_response_files() const
+    {
+        return m_response_files;
     }
 
 private:
+    friend class internal::response_files_expander<char_type>;
+
+    string_vector_type& get_modifiable_storage()
+    {
+        if (!m_storage_ptr || (m_storage_ptr.use_count() > 1))
+        {
+            m_storage_ptr = std::make_shared<string_vector_type>();
+        }
+        return *m_storage_ptr;
+    }
+
+    string_view_vector_type& get_modifiable_arguments()
+    {
+        if (!m_arguments_ptr || (m_arguments_ptr.use_count() > 1))
+        {
+            m_arguments_ptr = std::make_shared<string_view_vector_type>();
+        }
+        return *m_arguments_ptr;
+    }
+
     string_type m_app_name;
-    string_vector_type m_arguments;
+    std::shared_ptr<string_view_vector_type> m_arguments_ptr;
+    std::shared_ptr<string_vector_type> m_storage_ptr;
+    const_object_ptr_vector_type m_response_files;
 };
 
 /// \brief Iterator over input arguments table
@@ -85,6 +224,7 @@ public:
 
     using argument_table_type = basic_argument_table<char_type>;
     using string_type = std::basic_string<char_type>;
+    using string_view_type = basic_string_view<char_type>;
 
     explicit basic_argument_table_iterator(const argument_table_type& arg_table)
         : m_arg_table(arg_table)
@@ -104,24 +244,54 @@ public:
         return m_arg_index < m_arg_count;
     }
 
-    const string_type& peek_next() const
+    /// \brief Returns index (in arguments table) of the next argument
+    std::size_t get_index() const
+    {
+        return m_arg_index;
+    }
+
+    /// \brief Returns copy of the next argument (see basic_argument_table::get_argument())
+    string_type peek_next() const
+    {
+        return peek_next_view().to_string();
+    }
+
+    /// \brief Returns copy of the next argument and advances (see basic_argument_table::get_argument())
+    string_type take_next()
+    {
+        return take_next_view().to_string();
+    }
+
+    /// \brief Returns view of the next argument
+    string_view_type peek_next_view() const
     {
         if (!has_more())
         {
             throw std::out_of_range("No more arguments available");
         }
 
-        return m_arg_table.get_argument(m_arg_index);
+        return m_arg_table.get_argument_view(m_arg_index);
     }
 
-    const string_type& take_next()
+    /// \brief Returns view of the next argument and advances
+    string_view_type take_next_view()
     {
         if (!has_more())
         {
             throw std::out_of_range("No more arguments available");
         }
 
-        return m_arg_table.get_argument(m_arg_index++);
+        return m_arg_table.get_argument_view(m_arg_index++);
+    }
+
+    void skip(std::size_t count)
+    {
+        if (count > get_remaining_count())
+        {
+            throw std::out_of_range("No more arguments available");
+        }
+
+        m_arg_index += count;
     }
 
 private:
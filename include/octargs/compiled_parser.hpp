@@ -0,0 +1,50 @@
+#ifndef OCTARGS_COMPILED_PARSER_HPP_
+#define OCTARGS_COMPILED_PARSER_HPP_
+
+#include <memory>
+
+#include "parse_api.hpp"
+
+#include "internal/parser_snapshot.hpp"
+#include "internal/snapshot_source.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+/// \brief Compiled arguments parser
+///
+/// Compiled parser uses an immutable snapshot of the parser structure taken
+/// at the moment of compilation. Arguments and subparsers added to the source
+/// parser after the compilation are not visible to the compiled parser.
+///
+/// Parse functions are the same as in the parser (see basic_parse_api).
+///
+/// \tparam char_T              char type (as in std::basic_string)
+/// \tparam values_storage_T    type of class uses as a storage for parsed values
+template <typename char_T, typename values_storage_T>
+class basic_compiled_parser
+    : public basic_parse_api<char_T, values_storage_T, internal::fixed_snapshot_source<char_T, values_storage_T>>
+{
+public:
+    using char_type = char_T;
+    using values_storage_type = values_storage_T;
+
+    using snapshot_source_type = internal::fixed_snapshot_source<char_type, values_storage_type>;
+
+    using base_type = basic_parse_api<char_type, values_storage_type, snapshot_source_type>;
+
+    using const_snapshot_ptr_type = typename snapshot_source_type::const_snapshot_ptr_type;
+
+    explicit basic_compiled_parser(const const_snapshot_ptr_type& snapshot_ptr)
+        : base_type(snapshot_source_type(snapshot_ptr))
+    {
+        // noop
+    }
+};
+
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_COMPILED_PARSER_HPP_
@@ -6,6 +6,8 @@
 
 #include "dictionary.hpp"
 #include "exception.hpp"
+#include "string_view.hpp"
+#include "internal/number_utils.hpp"
 #include "internal/string_utils.hpp"
 
 namespace oct
@@ -39,11 +41,20 @@ public:
     using data_type = std::basic_string<char_type>;
 
     using string_type = std::basic_string<char_type>;
+    using string_view_type = basic_string_view<char_type>;
+    using dictionary_type = dictionary<char_type>;
 
     data_type operator()(const string_type& value_str) const
     {
         return value_str;
     }
+
+    /// \brief Converts the value without throwing (returns false if value is not valid)
+    bool try_convert(const dictionary_type& /*dictionary*/, string_view_type value_str, data_type& value) const
+    {
+        value.assign(value_str.data(), value_str.size());
+        return true;
+    }
 };
 
 /// \brief Converter for bool type
@@ -57,26 +68,23 @@ public:
     using data_type = bool;
 
     using string_type = std::basic_string<char_type>;
+    using string_view_type = basic_string_view<char_type>;
     using dictionary_type = dictionary<char_type>;
 
     data_type operator()(const dictionary_type& dictionary, const string_type& value_str) const
     {
-        auto comparator = std::bind(
-            internal::string_equal<char_type>(dictionary.is_case_sensitive()), value_str, std::placeholders::_1);
-
-        const auto& true_literals = dictionary.get_true_literals();
-        if (std::find_if(true_literals.begin(), true_literals.end(), comparator) != true_literals.end())
-        {
-            return true;
-        }
-
-        const auto& false_literals = dictionary.get_false_literals();
-        if (std::find_if(false_literals.begin(), false_literals.end(), comparator) != false_literals.end())
+        data_type value;
+        if (!try_convert(dictionary, value_str, value))
         {
-            return false;
+            throw conversion_error_ex<char_type>(value_str);
         }
+        return value;
+    }
 
-        throw conversion_error_ex<char_type>(value_str);
+    /// \brief Converts the value without throwing (returns false if value is not valid)
+    bool try_convert(const dictionary_type& dictionary, string_view_type value_str, data_type& value) const
+    {
+        return dictionary.match_bool_literal(value_str, value);
     }
 };
 
@@ -156,11 +164,83 @@ public:
     }
 };
 
+/// \brief Converter for integer types parsing the value in place
+///
+/// The value is parsed without copying (no memory allocation) and without
+/// throwing exceptions internally. Leading and trailing white spaces are
+/// ignored, base is detected from the prefix (0x - hexadecimal, 0 - octal).
+/// Negative values are not accepted for unsigned types.
+///
+/// \tparam char_T      char type (as in std::basic_string)
+/// \tparam data_T      data type (integer)
+template <typename char_T, typename data_T>
+class basic_in_place_integer_converter
+{
+public:
+    using char_type = char_T;
+    using data_type = data_T;
+
+    using string_type = std::basic_string<char_type>;
+    using string_view_type = basic_string_view<char_type>;
+    using dictionary_type = dictionary<char_type>;
+
+    data_type operator()(const string_type& value_str) const
+    {
+        data_type result;
+        if (!internal::parse_integer(value_str.data(), value_str.data() + value_str.size(), result))
+        {
+            throw conversion_error_ex<char_type>(value_str);
+        }
+        return result;
+    }
+
+    /// \brief Converts the value without throwing (returns false if value is not valid)
+    bool try_convert(const dictionary_type& /*dictionary*/, string_view_type value_str, data_type& value) const
+    {
+        return internal::parse_integer(value_str.data(), value_str.data() + value_str.size(), value);
+    }
+};
+
+/// \brief Converter for floating types parsing the value without exceptions
+///
+/// The value is parsed using strtod() family functions (so the accepted format
+/// is the same as for std::stod()) from a copy made on stack.
+///
+/// \tparam char_T      char type (as in std::basic_string)
+/// \tparam data_T      data type (floating)
+template <typename char_T, typename data_T>
+class basic_in_place_floating_point_converter
+{
+public:
+    using char_type = char_T;
+    using data_type = data_T;
+
+    using string_type = std::basic_string<char_type>;
+    using string_view_type = basic_string_view<char_type>;
+    using dictionary_type = dictionary<char_type>;
+
+    data_type operator()(const string_type& value_str) const
+    {
+        data_type result;
+        if (!internal::parse_floating_point(value_str.data(), value_str.data() + value_str.size(), result))
+        {
+            throw conversion_error_ex<char_type>(value_str);
+        }
+        return result;
+    }
+
+    /// \brief Converts the value without throwing (returns false if value is not valid)
+    bool try_convert(const dictionary_type& /*dictionary*/, string_view_type value_str, data_type& value) const
+    {
+        return internal::parse_floating_point(value_str.data(), value_str.data() + value_str.size(), value);
+    }
+};
+
 /// \brief Converter for float type
 ///
 /// \tparam char_T      char type (as in std::basic_string)
 template <typename char_T>
-class basic_converter<char_T, float> : public basic_floating_point_converter<char_T, float, std::stof>
+class basic_converter<char_T, float> : public basic_in_place_floating_point_converter<char_T, float>
 {
 };
 
@@ -168,7 +248,7 @@ class basic_converter<char_T, float> : public basic_floating_point_converter<cha
 ///
 /// \tparam char_T      char type (as in std::basic_string)
 template <typename char_T>
-class basic_converter<char_T, double> : public basic_floating_point_converter<char_T, double, std::stod>
+class basic_converter<char_T, double> : public basic_in_place_floating_point_converter<char_T, double>
 {
 };
 
@@ -176,7 +256,7 @@ class basic_converter<char_T, double> : public basic_floating_point_converter<ch
 ///
 /// \tparam char_T      char type (as in std::basic_string)
 template <typename char_T>
-class basic_converter<char_T, long double> : public basic_floating_point_converter<char_T, long double, std::stold>
+class basic_converter<char_T, long double> : public basic_in_place_floating_point_converter<char_T, long double>
 {
 };
 
@@ -184,8 +264,7 @@ class basic_converter<char_T, long double> : public basic_floating_point_convert
 ///
 /// \tparam char_T      char type (as in std::basic_string)
 template <typename char_T>
-class basic_converter<char_T, short>
-    : public basic_integer_converter<char_T, short, internal::stox<std::basic_string<char_T>, short>>
+class basic_converter<char_T, short> : public basic_in_place_integer_converter<char_T, short>
 {
 };
 
@@ -193,8 +272,7 @@ class basic_converter<char_T, short>
 ///
 /// \tparam char_T      char type (as in std::basic_string)
 template <typename char_T>
-class basic_converter<char_T, unsigned short>
-    : public basic_integer_converter<char_T, unsigned short, internal::stox<std::basic_string<char_T>, unsigned short>>
+class basic_converter<char_T, unsigned short> : public basic_in_place_integer_converter<char_T, unsigned short>
 {
 };
 
@@ -202,7 +280,7 @@ class basic_converter<char_T, unsigned short>
 ///
 /// \tparam char_T      char type (as in std::basic_string)
 template <typename char_T>
-class basic_converter<char_T, int> : public basic_integer_converter<char_T, int, std::stoi>
+class basic_converter<char_T, int> : public basic_in_place_integer_converter<char_T, int>
 {
 };
 
@@ -210,8 +288,7 @@ class basic_converter<char_T, int> : public basic_integer_converter<char_T, int,
 ///
 /// \tparam char_T      char type (as in std::basic_string)
 template <typename char_T>
-class basic_converter<char_T, unsigned int>
-    : public basic_integer_converter<char_T, unsigned int, internal::stox<std::basic_string<char_T>, unsigned int>>
+class basic_converter<char_T, unsigned int> : public basic_in_place_integer_converter<char_T, unsigned int>
 {
 };
 
@@ -219,7 +296,7 @@ class basic_converter<char_T, unsigned int>
 ///
 /// \tparam char_T      char type (as in std::basic_string)
 template <typename char_T>
-class basic_converter<char_T, long> : public basic_integer_converter<char_T, long, std::stol>
+class basic_converter<char_T, long> : public basic_in_place_integer_converter<char_T, long>
 {
 };
 
@@ -227,7 +304,7 @@ class basic_converter<char_T, long> : public basic_integer_converter<char_T, lon
 ///
 /// \tparam char_T      char type (as in std::basic_string)
 template <typename char_T>
-class basic_converter<char_T, unsigned long> : public basic_integer_converter<char_T, unsigned long, std::stoul>
+class basic_converter<char_T, unsigned long> : public basic_in_place_integer_converter<char_T, unsigned long>
 {
 };
 
@@ -235,7 +312,7 @@ class basic_converter<char_T, unsigned long> : public basic_integer_converter<ch
 ///
 /// \tparam char_T      char type (as in std::basic_string)
 template <typename char_T>
-class basic_converter<char_T, long long> : public basic_integer_converter<char_T, long long, std::stoll>
+class basic_converter<char_T, long long> : public basic_in_place_integer_converter<char_T, long long>
 {
 };
 
@@ -243,8 +320,7 @@ class basic_converter<char_T, long long> : public basic_integer_converter<char_T
 ///
 /// \tparam char_T      char type (as in std::basic_string)
 template <typename char_T>
-class basic_converter<char_T, unsigned long long>
-    : public basic_integer_converter<char_T, unsigned long long, std::stoull>
+class basic_converter<char_T, unsigned long long> : public basic_in_place_integer_converter<char_T, unsigned long long>
 {
 };
 
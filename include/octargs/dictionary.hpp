@@ -1,10 +1,15 @@
 #ifndef OCTARGS_DICTIONARY_HPP_
 #define OCTARGS_DICTIONARY_HPP_
 
+#include <array>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "internal/bool_literals.hpp"
+#include "internal/string_utils.hpp"
+#include "string_view.hpp"
+
 namespace oct
 {
 namespace args
@@ -23,6 +28,10 @@ public:
 
 /// \brief Parser literals dictionary
 ///
+/// Parsers read the literals used for parsing (i.e. value separator) and the
+/// case sensitivity when they prepare for parsing (see parser compile()), and
+/// prepare again when the dictionary revision changes.
+///
 /// \tparam char_T              char type (as in std::basic_string)
 template <typename char_T>
 class dictionary
@@ -50,9 +59,16 @@ public:
 
     using string_type = std::basic_string<char_type>;
     using string_vector_type = std::vector<string_type>;
+    using string_view_type = basic_string_view<char_type>;
 
     virtual ~dictionary() = default;
 
+    /// \brief Returns revision of the dictionary (changed on each modification)
+    std::size_t get_revision() const
+    {
+        return m_revision;
+    }
+
     virtual bool is_case_sensitive() const = 0;
 
     virtual const string_type& get_switch_enabled_literal() const = 0;
@@ -65,6 +81,51 @@ public:
     virtual const string_type& get_short_name_prefix() const = 0;
     virtual const string_type& get_long_name_prefix() const = 0;
     virtual const string_type& get_usage_literal(usage_literal key) const = 0;
+
+    /// \brief Matches value with true and false literals
+    ///
+    /// Returns true if value is one of the literals and sets the result to the
+    /// literal meaning (true literals are checked first). The default
+    /// implementation compares the value with all literals, dictionaries
+    /// could override it with a precompiled lookup.
+    virtual bool match_bool_literal(string_view_type value, bool& result) const
+    {
+        internal::string_equal<char_type> comparator(is_case_sensitive());
+
+        for (auto& literal : get_true_literals())
+        {
+            if (comparator(value, literal))
+            {
+                result = true;
+                return true;
+            }
+        }
+        for (auto& literal : get_false_literals())
+        {
+            if (comparator(value, literal))
+            {
+                result = false;
+                return true;
+            }
+        }
+        return false;
+    }
+
+protected:
+    dictionary()
+        : m_revision(0)
+    {
+        // noop
+    }
+
+    /// \brief Changes the revision (parsers using the dictionary prepare again)
+    void mark_modified()
+    {
+        ++m_revision;
+    }
+
+private:
+    std::size_t m_revision;
 };
 
 /// \brief Default implementation of parser literals dictionary
@@ -119,6 +180,18 @@ public:
         return FALSE_LITERALS;
     }
 
+    // cppcheck-suppress functionStatic
+    bool match_bool_literal(string_view_type value, bool& result) const override
+    {
+        auto match = internal::match_default_bool_literal(value.data(), value.size());
+        if (match < 0)
+        {
+            return false;
+        }
+        result = (match != 0);
+        return true;
+    }
+
     // cppcheck-suppress functionStatic
     const string_type& get_value_separator_literal() const override
     {
@@ -224,6 +297,18 @@ public:
         return FALSE_LITERALS;
     }
 
+    // cppcheck-suppress functionStatic
+    bool match_bool_literal(string_view_type value, bool& result) const override
+    {
+        auto match = internal::match_default_bool_literal(value.data(), value.size());
+        if (match < 0)
+        {
+            return false;
+        }
+        result = (match != 0);
+        return true;
+    }
+
     // cppcheck-suppress functionStatic
     const string_type& get_value_separator_literal() const override
     {
@@ -308,10 +393,14 @@ public:
     using char_type = typename base_type::char_type;
     using string_type = typename base_type::string_type;
     using string_vector_type = typename base_type::string_vector_type;
+    using string_view_type = typename base_type::string_view_type;
     using usage_literal = typename base_type::usage_literal;
 
     explicit custom_dictionary(init_mode requested_init_mode)
         : m_case_sensitive(true)
+        , m_usage_literals()
+        , m_usage_literals_set()
+        , m_bool_literal_matcher(m_case_sensitive, m_true_literals, m_false_literals)
     {
         if (requested_init_mode == init_mode::WITH_DEFAULTS)
         {
@@ -325,15 +414,22 @@ public:
             m_false_literals = default_dict.get_false_literals();
             m_value_separator_literal = default_dict.get_value_separator_literal();
             m_subparser_separator_literal = default_dict.get_subparser_separator_literal();
-            m_usage_literals = default_dict.get_usage_literals_map();
+            for (auto& entry : default_dict.get_usage_literals_map())
+            {
+                set_usage_literal_entry(entry.first, entry.second);
+            }
             m_short_name_prefix = default_dict.get_short_name_prefix();
             m_long_name_prefix = default_dict.get_long_name_prefix();
         }
+
+        update_bool_literal_matcher();
     }
 
     void set_case_sensitive(bool case_sensitive)
     {
         m_case_sensitive = case_sensitive;
+        update_bool_literal_matcher();
+        this->mark_modified();
     }
 
     bool is_case_sensitive() const override
@@ -344,6 +440,7 @@ public:
     void set_switch_enabled_literal(const string_type& literal)
     {
         m_switch_enabled_literal = literal;
+        this->mark_modified();
     }
 
     const string_type& get_switch_enabled_literal() const override
@@ -354,6 +451,8 @@ public:
     void add_true_literal(const string_type& literal)
     {
         m_true_literals.emplace_back(literal);
+        update_bool_literal_matcher();
+        this->mark_modified();
     }
 
     const string_vector_type& get_true_literals() const override
@@ -364,6 +463,8 @@ public:
     void add_false_literal(const string_type& literal)
     {
         m_false_literals.emplace_back(literal);
+        update_bool_literal_matcher();
+        this->mark_modified();
     }
 
     const string_vector_type& get_false_literals() const override
@@ -374,6 +475,7 @@ public:
     void set_value_separator_literal(const string_type& literal)
     {
         m_value_separator_literal = literal;
+        this->mark_modified();
     }
 
     const string_type& get_value_separator_literal() const override
@@ -384,6 +486,7 @@ public:
     void set_subparser_separator_literal(const string_type& literal)
     {
         m_value_separator_literal = literal;
+        this->mark_modified();
     }
 
     const string_type& get_subparser_separator_literal() const override
@@ -394,6 +497,7 @@ public:
     void set_short_name_prefix(const string_type& prefix)
     {
         m_short_name_prefix = prefix;
+        this->mark_modified();
     }
 
     const string_type& get_short_name_prefix() const override
@@ -404,6 +508,7 @@ public:
     void set_long_name_prefix(const string_type& prefix)
     {
         m_long_name_prefix = prefix;
+        this->mark_modified();
     }
 
     const string_type& get_long_name_prefix() const override
@@ -413,21 +518,45 @@ public:
 
     void set_usage_literal(usage_literal key, const string_type& value)
     {
-        m_usage_literals[key] = value;
+        set_usage_literal_entry(key, value);
+        this->mark_modified();
     }
 
     const string_type& get_usage_literal(usage_literal key) const override
     {
-        auto iter = m_usage_literals.find(key);
-        if (iter != m_usage_literals.end())
+        auto index = static_cast<std::size_t>(key);
+        if ((index < USAGE_LITERAL_COUNT) && m_usage_literals_set[index])
         {
-            return iter->second;
+            return m_usage_literals[index];
         }
         throw invalid_dictionary_key(std::string("Invalid key: ") + std::to_string(static_cast<int>(key)));
     }
 
+    bool match_bool_literal(string_view_type value, bool& result) const override
+    {
+        return m_bool_literal_matcher.match(value, result);
+    }
+
 private:
-    using usage_string_map = std::map<usage_literal, string_type>;
+    static const std::size_t USAGE_LITERAL_COUNT = static_cast<std::size_t>(usage_literal::DECORATOR_ALLOWED) + 1;
+
+    using bool_literal_matcher_type = internal::basic_bool_literal_matcher<char_type>;
+
+    void set_usage_literal_entry(usage_literal key, const string_type& value)
+    {
+        auto index = static_cast<std::size_t>(key);
+        if (index >= USAGE_LITERAL_COUNT)
+        {
+            throw invalid_dictionary_key(std::string("Invalid key: ") + std::to_string(static_cast<int>(key)));
+        }
+        m_usage_literals[index] = value;
+        m_usage_literals_set[index] = true;
+    }
+
+    void update_bool_literal_matcher()
+    {
+        m_bool_literal_matcher = bool_literal_matcher_type(m_case_sensitive, m_true_literals, m_false_literals);
+    }
 
     bool m_case_sensitive;
     string_type m_switch_enabled_literal;
@@ -435,9 +564,13 @@ private:
     string_vector_type m_false_literals;
     string_type m_value_separator_literal;
     string_type m_subparser_separator_literal;
-    usage_string_map m_usage_literals;
+    /// Usage literals indexed by key (no map lookup per usage line).
+    std::array<string_type, USAGE_LITERAL_COUNT> m_usage_literals;
+    std::array<bool, USAGE_LITERAL_COUNT> m_usage_literals_set;
     string_type m_short_name_prefix;
     string_type m_long_name_prefix;
+    /// Literals table rebuilt on each literals or case sensitivity change.
+    bool_literal_matcher_type m_bool_literal_matcher;
 };
 
 } // namespace args
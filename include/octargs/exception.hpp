@@ -3,6 +3,7 @@
 
 #include <exception>
 #include <memory>
+#include <stdexcept>
 #include <string>
 
 namespace oct
@@ -249,6 +250,95 @@ private:
     basic_shared_string<char_type> m_name;
 };
 
+//---------------------------------
+
+/// \brief Exception thrown when default value of an argument is invalid
+///
+/// The exception is thrown when the parser definition is prepared for
+/// parsing (i.e. on first parse or when the parser is compiled). If the value
+/// could not be converted the conversion exception is nested.
+class invalid_default_value : public std::logic_error
+{
+public:
+    explicit invalid_default_value(const std::string& message)
+        : std::logic_error(message)
+    {
+        // noop
+    }
+};
+
+/// \brief Exception thrown when default value of an argument is invalid
+///
+/// \tparam char_T      char type (as in std::basic_string)
+template <typename char_T>
+class invalid_default_value_ex : public invalid_default_value
+{
+public:
+    using char_type = char_T;
+    using string_type = std::basic_string<char_type>;
+
+    explicit invalid_default_value_ex(const std::string& message, const string_type& name, const string_type& value)
+        : invalid_default_value(message)
+        , m_name(name)
+        , m_value(value)
+    {
+        // noop
+    }
+
+    const string_type& get_name() const
+    {
+        return m_name;
+    }
+
+    const string_type& get_value() const
+    {
+        return m_value;
+    }
+
+private:
+    basic_shared_string<char_type> m_name;
+    basic_shared_string<char_type> m_value;
+};
+
+//---------------------------------
+
+/// \brief Exception thrown when response file could not be expanded
+class response_file_error : public std::runtime_error
+{
+public:
+    explicit response_file_error(const std::string& message)
+        : std::runtime_error(message)
+    {
+        // noop
+    }
+};
+
+/// \brief Exception thrown when response file could not be expanded
+///
+/// \tparam char_T      char type (as in std::basic_string)
+template <typename char_T>
+class response_file_error_ex : public response_file_error
+{
+public:
+    using char_type = char_T;
+    using string_type = std::basic_string<char_type>;
+
+    explicit response_file_error_ex(const std::string& message, const string_type& path)
+        : response_file_error(message)
+        , m_path(path)
+    {
+        // noop
+    }
+
+    const string_type& get_path() const
+    {
+        return m_path;
+    }
+
+private:
+    basic_shared_string<char_type> m_path;
+};
+
 } // namespace args
 } // namespace oct
 
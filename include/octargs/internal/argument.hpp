@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "../exception.hpp"
+#include "../string_view.hpp"
 #include "argument_handler.hpp"
 
 namespace oct
@@ -20,6 +21,22 @@ class basic_argument_tag
 {
 public:
     virtual ~basic_argument_tag() = default;
+
+    std::size_t get_slot() const
+    {
+        return m_slot;
+    }
+
+protected:
+    explicit basic_argument_tag(std::size_t slot)
+        : m_slot(slot)
+    {
+        // noop
+    }
+
+private:
+    /// Index of the slot in which argument values are stored in results.
+    std::size_t m_slot;
 };
 
 template <typename char_T, typename values_storage_T>
@@ -31,6 +48,7 @@ public:
 
     using string_type = std::basic_string<char_type>;
     using string_vector_type = std::vector<string_type>;
+    using string_view_type = basic_string_view<char_type>;
     using handler_type = basic_argument_handler<char_type, values_storage_type>;
     using const_handler_ptr_type = std::shared_ptr<const handler_type>;
 
@@ -63,6 +81,15 @@ public:
     virtual bool is_accepting_immediate_value() const = 0;
 
     virtual bool is_accepting_separate_value() const = 0;
+
+    virtual bool is_storing_values_as_range() const = 0;
+
+protected:
+    explicit basic_argument(std::size_t slot)
+        : basic_argument_tag(slot)
+    {
+        // noop
+    }
 };
 
 } // namespace internal
@@ -2,6 +2,7 @@
 #define OCTARGS_ARGUMENT_BASE_IMPL_HPP_
 
 #include "argument.hpp"
+#include "parser_tree_state.hpp"
 
 namespace oct
 {
@@ -26,6 +27,7 @@ public:
 
     using string_type = std::basic_string<char_type>;
     using string_vector_type = std::vector<string_type>;
+    using string_view_type = basic_string_view<char_type>;
 
     using handler_type = basic_argument_handler<char_type, values_storage_type>;
     using const_handler_ptr_type = std::shared_ptr<const handler_type>;
@@ -34,6 +36,8 @@ public:
     using parser_data_ptr_type = std::shared_ptr<parser_data_type>;
     using parser_data_weak_ptr_type = std::weak_ptr<parser_data_type>;
 
+    using tree_state_ptr_type = std::shared_ptr<parser_tree_state>;
+
     const string_type& get_first_name() const final
     {
         return m_names[0];
@@ -104,6 +108,11 @@ public:
         return (m_flags & FLAG_IS_ACCEPTING_SEPARATE_VALUE);
     }
 
+    bool is_storing_values_as_range() const final
+    {
+        return (m_flags & FLAG_IS_STORING_VALUES_AS_RANGE);
+    }
+
     void set_description(const string_type& text)
     {
         m_description = text;
@@ -112,6 +121,7 @@ public:
     void set_handler(const const_handler_ptr_type& handler_ptr)
     {
         m_handler_ptr = handler_ptr;
+        mark_parser_modified();
     }
 
     parser_data_ptr_type get_parser_data() const
@@ -124,6 +134,13 @@ public:
         return ptr;
     }
 
+    /// \brief Returns state of the parsers tree owning the argument (null if the parser was freed)
+    tree_state_ptr_type get_tree_state() const
+    {
+        auto ptr = m_parser_data_ptr.lock();
+        return ptr ? ptr->m_tree_state : tree_state_ptr_type();
+    }
+
 protected:
     enum flags : std::uint32_t
     {
@@ -131,13 +148,14 @@ protected:
         FLAG_IS_ASSIGNABLE_BY_NAME = (1 << 1),
         FLAG_IS_ACCEPTING_IMMEDIATE_VALUE = (1 << 2),
         FLAG_IS_ACCEPTING_SEPARATE_VALUE = (1 << 3),
+        FLAG_IS_STORING_VALUES_AS_RANGE = (1 << 4),
     };
 
     static const std::uint32_t ZERO_FLAGS = 0;
 
-    explicit basic_argument_base_impl(
-        parser_data_weak_ptr_type parser_data_ptr, std::uint32_t flags, const string_vector_type& names)
-        : base_type()
+    explicit basic_argument_base_impl(parser_data_weak_ptr_type parser_data_ptr, std::size_t slot,
+        std::uint32_t flags, const string_vector_type& names)
+        : base_type(slot)
         , m_parser_data_ptr(parser_data_ptr)
         , m_flags(flags)
         , m_names(names)
@@ -151,14 +169,28 @@ protected:
         // noop
     }
 
+    void set_flag(std::uint32_t flag, bool enabled)
+    {
+        if (enabled)
+        {
+            m_flags |= flag;
+        }
+        else
+        {
+            m_flags &= ~flag;
+        }
+    }
+
     void set_default_values_internal(const string_vector_type& values)
     {
         m_default_values = values;
+        mark_parser_modified();
     }
 
     void set_allowed_values_internal(const string_vector_type& values)
     {
         m_allowed_values = values;
+        mark_parser_modified();
     }
 
     void set_value_name_internal(const string_type& name)
@@ -169,11 +201,13 @@ protected:
     void set_min_count(std::size_t count)
     {
         m_min_count = count;
+        mark_parser_modified();
     }
 
     void set_max_count(std::size_t count)
     {
         m_max_count = count;
+        mark_parser_modified();
     }
 
     void set_max_count_unlimited()
@@ -182,6 +216,16 @@ protected:
     }
 
 private:
+    /// Invalidates parser snapshots (they keep lists of arguments and converted default values).
+    void mark_parser_modified()
+    {
+        auto tree_state = get_tree_state();
+        if (tree_state)
+        {
+            tree_state->mark_modified();
+        }
+    }
+
     /// (Weak) Pointer to owning parser data.
     parser_data_weak_ptr_type m_parser_data_ptr;
     /// Flags
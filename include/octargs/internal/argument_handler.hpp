@@ -2,6 +2,8 @@
 #define OCTARGS_ARGUMENT_HANDLER_HPP_
 
 #include "../dictionary.hpp"
+#include "../string_view.hpp"
+#include "typed_value.hpp"
 
 namespace oct
 {
@@ -17,14 +19,32 @@ public:
     using char_type = char_T;
     using values_storage_type = values_storage_T;
 
-    using string_type = std::basic_string<char_T>;
+    using string_view_type = basic_string_view<char_T>;
 
     using dictionary_type = dictionary<char_type>;
 
     virtual ~basic_argument_handler() = default;
 
-    virtual void parse(
-        values_storage_type& storage, const dictionary_type& dictionary, const string_type& value_str) const = 0;
+    /// Converted value is returned in converted_value (for reuse by results).
+    /// Returns false if built-in converter rejected the value (custom
+    /// converters report errors with conversion_error exceptions).
+    virtual bool parse(values_storage_type& storage, const dictionary_type& dictionary, string_view_type value_str,
+        typed_value& converted_value) const = 0;
+
+    /// Converts and checks the value without storing it (see parse()).
+    virtual bool convert(
+        const dictionary_type& dictionary, string_view_type value_str, typed_value& converted_value) const = 0;
+
+    /// Converts the value with the converter only (see parse()). Used when
+    /// converter and check functions are timed separately.
+    virtual bool convert_value(
+        const dictionary_type& dictionary, string_view_type value_str, typed_value& converted_value) const = 0;
+
+    /// Checks the value previously returned by convert_value().
+    virtual void check_value(const typed_value& converted_value) const = 0;
+
+    /// Stores the value previously returned by convert().
+    virtual void store(values_storage_type& storage, const typed_value& converted_value) const = 0;
 };
 
 template <typename char_T>
@@ -33,13 +53,32 @@ class basic_argument_handler<char_T, void>
 public:
     using char_type = char_T;
 
-    using string_type = std::basic_string<char_T>;
+    using string_view_type = basic_string_view<char_T>;
 
     using dictionary_type = dictionary<char_type>;
 
     virtual ~basic_argument_handler() = default;
 
-    virtual void parse(const dictionary_type& dictionary, const string_type& value_str) const = 0;
+    /// Converted value is returned in converted_value (for reuse by results).
+    /// Returns false if built-in converter rejected the value (custom
+    /// converters report errors with conversion_error exceptions).
+    virtual bool parse(
+        const dictionary_type& dictionary, string_view_type value_str, typed_value& converted_value) const = 0;
+
+    /// Converts and checks the value without storing it (see parse()).
+    virtual bool convert(
+        const dictionary_type& dictionary, string_view_type value_str, typed_value& converted_value) const = 0;
+
+    /// Converts the value with the converter only (see parse()). Used when
+    /// converter and check functions are timed separately.
+    virtual bool convert_value(
+        const dictionary_type& dictionary, string_view_type value_str, typed_value& converted_value) const = 0;
+
+    /// Checks the value previously returned by convert_value().
+    virtual void check_value(const typed_value& converted_value) const = 0;
+
+    /// Stores the value previously returned by convert().
+    virtual void store(const typed_value& converted_value) const = 0;
 };
 
 template <typename char_T, typename values_storage_T>
@@ -49,7 +88,7 @@ public:
     using char_type = char_T;
     using values_storage_type = values_storage_T;
 
-    using string_type = std::basic_string<char_T>;
+    using string_view_type = basic_string_view<char_T>;
     using argument_handler_type = basic_argument_handler<char_T, values_storage_T>;
     using dictionary_type = dictionary<char_type>;
 
@@ -59,10 +98,27 @@ public:
         // noop
     }
 
-    void parse_with_handler(
-        const argument_handler_type& handler, const dictionary_type& dictionary, const string_type& value_str)
+    bool parse_with_handler(const argument_handler_type& handler, const dictionary_type& dictionary,
+        string_view_type value_str, typed_value& converted_value)
+    {
+        return handler.parse(m_storage, dictionary, value_str, converted_value);
+    }
+
+    void store_with_handler(const argument_handler_type& handler, const typed_value& converted_value)
+    {
+        handler.store(m_storage, converted_value);
+    }
+
+    bool convert_with_handler(const argument_handler_type& handler, const dictionary_type& dictionary,
+        string_view_type value_str, typed_value& converted_value)
     {
-        handler.parse(m_storage, dictionary, value_str);
+        return handler.convert_value(dictionary, value_str, converted_value);
+    }
+
+    void check_and_store_with_handler(const argument_handler_type& handler, const typed_value& converted_value)
+    {
+        handler.check_value(converted_value);
+        handler.store(m_storage, converted_value);
     }
 
 private:
@@ -75,15 +131,74 @@ class storage_handler_helper<char_T, void>
 public:
     using char_type = char_T;
 
-    using string_type = std::basic_string<char_T>;
+    using string_view_type = basic_string_view<char_T>;
     using argument_handler_type = basic_argument_handler<char_T, void>;
     using dictionary_type = dictionary<char_type>;
 
     // cppcheck-suppress functionStatic
-    void parse_with_handler(
-        const argument_handler_type& handler, const dictionary_type& dictionary, const string_type& value_str)
+    bool parse_with_handler(const argument_handler_type& handler, const dictionary_type& dictionary,
+        string_view_type value_str, typed_value& converted_value)
+    {
+        return handler.parse(dictionary, value_str, converted_value);
+    }
+
+    // cppcheck-suppress functionStatic
+    void store_with_handler(const argument_handler_type& handler, const typed_value& converted_value)
+    {
+        handler.store(converted_value);
+    }
+
+    // cppcheck-suppress functionStatic
+    bool convert_with_handler(const argument_handler_type& handler, const dictionary_type& dictionary,
+        string_view_type value_str, typed_value& converted_value)
+    {
+        return handler.convert_value(dictionary, value_str, converted_value);
+    }
+
+    // cppcheck-suppress functionStatic
+    void check_and_store_with_handler(const argument_handler_type& handler, const typed_value& converted_value)
+    {
+        handler.check_value(converted_value);
+        handler.store(converted_value);
+    }
+};
+
+/// \brief Handler helper used for validation (values are converted and checked but never stored)
+template <typename char_T, typename values_storage_T>
+class validation_handler_helper
+{
+public:
+    using char_type = char_T;
+    using values_storage_type = values_storage_T;
+
+    using string_view_type = basic_string_view<char_T>;
+    using argument_handler_type = basic_argument_handler<char_T, values_storage_T>;
+    using dictionary_type = dictionary<char_type>;
+
+    // cppcheck-suppress functionStatic
+    bool parse_with_handler(const argument_handler_type& handler, const dictionary_type& dictionary,
+        string_view_type value_str, typed_value& converted_value)
+    {
+        return handler.convert(dictionary, value_str, converted_value);
+    }
+
+    // cppcheck-suppress functionStatic
+    void store_with_handler(const argument_handler_type& /*handler*/, const typed_value& /*converted_value*/)
+    {
+        // noop
+    }
+
+    // cppcheck-suppress functionStatic
+    bool convert_with_handler(const argument_handler_type& handler, const dictionary_type& dictionary,
+        string_view_type value_str, typed_value& converted_value)
+    {
+        return handler.convert_value(dictionary, value_str, converted_value);
+    }
+
+    // cppcheck-suppress functionStatic
+    void check_and_store_with_handler(const argument_handler_type& handler, const typed_value& converted_value)
     {
-        handler.parse(dictionary, value_str);
+        handler.check_value(converted_value);
     }
 };
 
@@ -10,6 +10,7 @@
 #include "argument.hpp"
 #include "exclusive_argument_impl.hpp"
 #include "name_checker.hpp"
+#include "parser_tree_state.hpp"
 #include "positional_argument_impl.hpp"
 #include "string_utils.hpp"
 #include "subparser_argument_impl.hpp"
@@ -58,8 +59,11 @@ public:
     using parser_data_type = basic_parser_data<char_type, values_storage_type>;
     using parser_data_weak_ptr_type = std::weak_ptr<parser_data_type>;
 
-    basic_argument_repository(const_dictionary_ptr_type dictionary)
-        : m_dictionary(check_dictionary(dictionary))
+    using tree_state_ptr_type = std::shared_ptr<parser_tree_state>;
+
+    basic_argument_repository(const_dictionary_ptr_type dictionary, tree_state_ptr_type tree_state)
+        : m_tree_state(tree_state)
+        , m_dictionary(check_dictionary(dictionary))
         , m_arguments()
         , m_subparsers_argument()
         , m_names_repository(string_less_type(dictionary->is_case_sensitive()))
@@ -72,7 +76,8 @@ public:
     {
         check_names(names);
 
-        auto new_argument = std::make_shared<exclusive_argument_type>(parser_data_ptr, names);
+        auto slot = m_tree_state->allocate_slot();
+        auto new_argument = std::make_shared<exclusive_argument_type>(parser_data_ptr, slot, names);
 
         add_to_names_repository(new_argument);
         m_arguments.emplace_back(new_argument);
@@ -84,7 +89,8 @@ public:
     {
         check_names(names);
 
-        auto new_argument = std::make_shared<switch_argument_type>(parser_data_ptr, names);
+        auto slot = m_tree_state->allocate_slot();
+        auto new_argument = std::make_shared<switch_argument_type>(parser_data_ptr, slot, names);
 
         add_to_names_repository(new_argument);
         m_arguments.emplace_back(new_argument);
@@ -96,7 +102,8 @@ public:
     {
         check_names(names);
 
-        auto new_argument = std::make_shared<valued_argument_type>(parser_data_ptr, names);
+        auto slot = m_tree_state->allocate_slot();
+        auto new_argument = std::make_shared<valued_argument_type>(parser_data_ptr, slot, names);
 
         add_to_names_repository(new_argument);
         m_arguments.emplace_back(new_argument);
@@ -114,7 +121,8 @@ public:
             throw subparser_positional_conflict("subparser argument already registered");
         }
 
-        auto new_argument = std::make_shared<positional_argument_type>(parser_data_ptr, names);
+        auto slot = m_tree_state->allocate_slot();
+        auto new_argument = std::make_shared<positional_argument_type>(parser_data_ptr, slot, names);
 
         add_to_names_repository(new_argument);
         m_arguments.emplace_back(new_argument);
@@ -136,7 +144,8 @@ public:
             throw subparser_positional_conflict("positional arguments already registered");
         }
 
-        auto new_argument = std::make_shared<subparser_argument_type>(parser_data_ptr, names);
+        auto slot = m_tree_state->allocate_slot();
+        auto new_argument = std::make_shared<subparser_argument_type>(parser_data_ptr, slot, names);
 
         add_to_names_repository(new_argument);
         m_subparsers_argument = new_argument;
@@ -198,6 +207,8 @@ private:
         ensure_names_not_registered(names);
     }
 
+    tree_state_ptr_type m_tree_state;
+
 public:
     const_dictionary_ptr_type m_dictionary;
     std::vector<const_argument_ptr_type> m_arguments;
@@ -2,10 +2,16 @@
 #define OCTARGS_ARGUMENT_TYPE_HANDLER_HPP_
 
 #include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "../converter.hpp"
+#include "../string_view.hpp"
 #include "argument_handler.hpp"
 #include "function_helpers.hpp"
+#include "parser_tree_state.hpp"
+#include "typed_value.hpp"
 
 namespace oct
 {
@@ -42,6 +48,9 @@ public:
     using char_type = char_T;
     using values_storage_type = values_storage_T;
 
+    using string_view_type = basic_string_view<char_type>;
+    using dictionary_type = dictionary<char_type>;
+
     using convert_helper = convert_function_helper<char_type, data_type>;
     using check_helper = check_function_helper<char_type, data_type>;
     using store_helper = store_function_helper<char_type, data_type, values_storage_type>;
@@ -50,25 +59,61 @@ public:
     using check_function_type = typename check_helper::function_type;
     using store_function_type = typename store_helper::function_type;
 
+    using default_converter_type = basic_converter<char_type, data_type>;
+
     using storage_helper_wrapped_type = typename storage_helper<values_storage_type>::type;
 
+    using member_ptr_type = data_type storage_helper_wrapped_type::*;
+    using vector_member_ptr_type = std::vector<data_type> storage_helper_wrapped_type::*;
+
+    using tree_state_ptr_type = std::shared_ptr<parser_tree_state>;
+
     basic_argument_type_handler_base()
-        : m_convert_function()
+        : m_tree_state()
+        , m_convert_function()
+        , m_default_converter(false)
+        , m_converter_id(nullptr)
         , m_check_function()
         , m_store_function()
+        , m_member_ptr(nullptr)
+        , m_vector_member_ptr(nullptr)
     {
         // noop
     }
 
+    /// Parsers tree notified on changes (parser snapshots keep converted default values).
+    void set_tree_state(const tree_state_ptr_type& tree_state)
+    {
+        m_tree_state = tree_state;
+    }
+
     template <typename function_T>
     void set_convert_function(const function_T& func)
     {
+        mark_modified();
         m_convert_function = convert_helper::prepare(func);
+        m_default_converter = false;
+
+        // stateless converter objects are all equivalent so converted values
+        // could be reused by results getters using the same converter type
+        m_converter_id = (std::is_class<function_T>::value && std::is_empty<function_T>::value)
+            ? get_type_id<function_T>()
+            : nullptr;
+    }
+
+    /// Built-in converter is called directly (could be inlined).
+    void set_convert_function(const default_converter_type& /*converter*/)
+    {
+        mark_modified();
+        m_convert_function = convert_function_type();
+        m_default_converter = true;
+        m_converter_id = get_type_id<default_converter_type>();
     }
 
     template <typename function_T>
     void set_check_function(const function_T& func)
     {
+        mark_modified();
         m_check_function = check_helper::prepare(func);
     }
 
@@ -76,27 +121,145 @@ public:
     void set_store_function(const function_T& func)
     {
         m_store_function = store_helper::prepare(func);
+        m_member_ptr = nullptr;
+        m_vector_member_ptr = nullptr;
     }
 
-    // cppcheck-suppress functionStatic
-    void set_storage(data_type storage_helper_wrapped_type::*member_ptr)
+    void set_storage(member_ptr_type member_ptr)
     {
-        set_store_function(
-            [member_ptr](values_storage_type& storage, const data_type& value) { storage.*member_ptr = value; });
+        static_assert(!std::is_void<values_storage_type>::value, "storage requires values storage type");
+
+        m_store_function = store_function_type();
+        m_member_ptr = member_ptr;
+        m_vector_member_ptr = nullptr;
     }
 
-    // cppcheck-suppress functionStatic
-    void set_storage(std::vector<data_type> storage_helper_wrapped_type::*member_ptr)
+    void set_storage(vector_member_ptr_type member_ptr)
     {
-        set_store_function([member_ptr](values_storage_type& storage, const data_type& value) {
-            (storage.*member_ptr).emplace_back(value);
-        });
+        static_assert(!std::is_void<values_storage_type>::value, "storage requires values storage type");
+
+        m_store_function = store_function_type();
+        m_member_ptr = nullptr;
+        m_vector_member_ptr = member_ptr;
+    }
+
+    /// Converts the value with the converter only (check function is not called).
+    bool convert_value(
+        const dictionary_type& dictionary, string_view_type value_str, typed_value& converted_value) const final
+    {
+        return convert_with(dictionary, value_str,
+            [this, &converted_value](data_type&& value) { converted_value.emplace(m_converter_id, std::move(value)); });
+    }
+
+    /// Calls the check function for the value returned by convert_value().
+    void check_value(const typed_value& converted_value) const final
+    {
+        auto value_ptr = converted_value.get<data_type>();
+        if (value_ptr)
+        {
+            check(*value_ptr);
+        }
     }
 
 protected:
+    using has_default_converter
+        = std::integral_constant<bool, !std::is_void<typename default_converter_type::data_type>::value>;
+
+    /// Converts and checks the value, then passes it to store function and
+    /// to converted_value. Returns false if built-in converter rejected the
+    /// value (without exceptions).
+    template <typename store_T>
+    bool convert_and_store(const dictionary_type& dictionary, string_view_type value_str,
+        typed_value& converted_value, const store_T& store) const
+    {
+        return convert_with(dictionary, value_str, [this, &converted_value, &store](data_type&& value) {
+            this->check_and_store(std::move(value), converted_value, store);
+        });
+    }
+
+    /// Converts and checks the value without storing it.
+    bool convert_only(
+        const dictionary_type& dictionary, string_view_type value_str, typed_value& converted_value) const
+    {
+        return convert_and_store(dictionary, value_str, converted_value, [](const data_type& /*value*/) {});
+    }
+
+    void check(const data_type& value) const
+    {
+        if (m_check_function)
+        {
+            m_check_function(value);
+        }
+    }
+
+    tree_state_ptr_type m_tree_state;
     convert_function_type m_convert_function;
+    bool m_default_converter;
+    type_id_type m_converter_id;
     check_function_type m_check_function;
     store_function_type m_store_function;
+    member_ptr_type m_member_ptr;
+    vector_member_ptr_type m_vector_member_ptr;
+
+private:
+    void mark_modified()
+    {
+        if (m_tree_state)
+        {
+            m_tree_state->mark_modified();
+        }
+    }
+
+    template <typename store_T>
+    void check_and_store(data_type&& value, typed_value& converted_value, const store_T& store) const
+    {
+        check(value);
+
+        store(value);
+
+        converted_value.emplace(m_converter_id, std::move(value));
+    }
+
+    /// Converts the value and passes it to consume function. Returns false
+    /// if built-in converter rejected the value.
+    template <typename consume_T>
+    bool convert_with(const dictionary_type& dictionary, string_view_type value_str, const consume_T& consume) const
+    {
+        if (m_default_converter)
+        {
+            return convert_default_with(dictionary, value_str, consume, has_default_converter());
+        }
+
+        if (!m_convert_function)
+        {
+            throw missing_converter_ex<char_type>(value_str.to_string());
+        }
+
+        // custom converters take strings, so the value is copied only for them
+        consume(m_convert_function(dictionary, value_str.to_string()));
+        return true;
+    }
+
+    template <typename consume_T>
+    bool convert_default_with(const dictionary_type& dictionary, string_view_type value_str, const consume_T& consume,
+        std::true_type /*has_default_converter*/) const
+    {
+        data_type value;
+        if (!default_converter_type().try_convert(dictionary, value_str, value))
+        {
+            return false;
+        }
+
+        consume(std::move(value));
+        return true;
+    }
+
+    template <typename consume_T>
+    bool convert_default_with(const dictionary_type& /*dictionary*/, string_view_type value_str,
+        const consume_T& /*consume*/, std::false_type /*has_default_converter*/) const
+    {
+        throw missing_converter_ex<char_type>(value_str.to_string());
+    }
 };
 
 template <typename data_T, typename char_T, typename values_storage_T>
@@ -107,25 +270,43 @@ public:
     using char_type = char_T;
     using values_storage_type = values_storage_T;
 
-    using string_type = std::basic_string<char_type>;
+    using string_view_type = basic_string_view<char_type>;
     using dictionary_type = dictionary<char_type>;
 
-    void parse(
-        values_storage_type& storage, const dictionary_type& dictionary, const string_type& value_str) const final
+    bool parse(values_storage_type& storage, const dictionary_type& dictionary, string_view_type value_str,
+        typed_value& converted_value) const final
     {
-        if (!this->m_convert_function)
-        {
-            throw missing_converter_ex<char_type>(value_str);
-        }
+        return this->convert_and_store(dictionary, value_str, converted_value,
+            [this, &storage](const data_type& value) { this->store_value(storage, value); });
+    }
 
-        data_type value = this->m_convert_function(dictionary, value_str);
+    bool convert(
+        const dictionary_type& dictionary, string_view_type value_str, typed_value& converted_value) const final
+    {
+        return this->convert_only(dictionary, value_str, converted_value);
+    }
 
-        if (this->m_check_function)
+    void store(values_storage_type& storage, const typed_value& converted_value) const final
+    {
+        auto value_ptr = converted_value.get<data_type>();
+        if (value_ptr)
         {
-            this->m_check_function(value);
+            store_value(storage, *value_ptr);
         }
+    }
 
-        if (this->m_store_function)
+private:
+    void store_value(values_storage_type& storage, const data_type& value) const
+    {
+        if (this->m_member_ptr)
+        {
+            storage.*(this->m_member_ptr) = value;
+        }
+        else if (this->m_vector_member_ptr)
+        {
+            (storage.*(this->m_vector_member_ptr)).emplace_back(value);
+        }
+        else if (this->m_store_function)
         {
             this->m_store_function(storage, value);
         }
@@ -139,23 +320,34 @@ public:
     using data_type = data_T;
     using char_type = char_T;
 
-    using string_type = std::basic_string<char_type>;
+    using string_view_type = basic_string_view<char_type>;
     using dictionary_type = dictionary<char_type>;
 
-    void parse(const dictionary_type& dictionary, const string_type& value_str) const final
+    bool parse(
+        const dictionary_type& dictionary, string_view_type value_str, typed_value& converted_value) const final
     {
-        if (!this->m_convert_function)
-        {
-            throw missing_converter_ex<char_type>(value_str);
-        }
+        return this->convert_and_store(
+            dictionary, value_str, converted_value, [this](const data_type& value) { this->store_value(value); });
+    }
 
-        data_type value = this->m_convert_function(dictionary, value_str);
+    bool convert(
+        const dictionary_type& dictionary, string_view_type value_str, typed_value& converted_value) const final
+    {
+        return this->convert_only(dictionary, value_str, converted_value);
+    }
 
-        if (this->m_check_function)
+    void store(const typed_value& converted_value) const final
+    {
+        auto value_ptr = converted_value.get<data_type>();
+        if (value_ptr)
         {
-            this->m_check_function(value);
+            store_value(*value_ptr);
         }
+    }
 
+private:
+    void store_value(const data_type& value) const
+    {
         if (this->m_store_function)
         {
             this->m_store_function(value);
@@ -0,0 +1,195 @@
+#ifndef OCTARGS_BATCH_PARSER_ENGINE_HPP_
+#define OCTARGS_BATCH_PARSER_ENGINE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../argument_table.hpp"
+#include "../parse_result.hpp"
+#include "parser_engine.hpp"
+#include "parser_snapshot.hpp"
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+/// \brief Parser engine parsing many argument tables concurrently
+///
+/// Tables are split into chunks that are claimed by the worker threads (the
+/// calling thread included) from a shared atomic counter, so threads that
+/// finish early take over the remaining work. The counter is the only shared
+/// state updated during parsing - each worker owns a private reference to the
+/// snapshot and all results created by the worker share ownership with it,
+/// so the snapshot, dictionary and names index reference counts are not
+/// updated concurrently.
+///
+/// \tparam char_T              char type (as in std::basic_string)
+/// \tparam values_storage_T    type of class uses as a storage for parsed values
+template <typename char_T, typename values_storage_T>
+class basic_batch_parser_engine
+{
+public:
+    using char_type = char_T;
+    using values_storage_type = values_storage_T;
+
+    using argument_table_type = basic_argument_table<char_type>;
+    using parse_result_type = basic_parse_result<char_type>;
+    using parse_result_vector_type = std::vector<parse_result_type>;
+
+    using snapshot_type = basic_parser_snapshot<char_type, values_storage_type>;
+    using const_snapshot_ptr_type = std::shared_ptr<const snapshot_type>;
+
+    /// Maximum number of tables claimed by a worker at once.
+    static const std::size_t MAX_CHUNK_SIZE = 256;
+
+    /// Thread count of zero selects the number of hardware threads.
+    basic_batch_parser_engine(const const_snapshot_ptr_type& root_snapshot_ptr, std::size_t thread_count)
+        : m_root_snapshot_ptr(root_snapshot_ptr)
+        , m_thread_count(thread_count)
+    {
+        if (m_thread_count == 0)
+        {
+            m_thread_count = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        }
+    }
+
+    template <typename iterator_T>
+    parse_result_vector_type parse(iterator_T first, iterator_T last)
+    {
+        const auto table_count = static_cast<std::size_t>(last - first);
+        if (table_count == 0)
+        {
+            return parse_result_vector_type();
+        }
+
+        const auto chunk_size
+            = std::max<std::size_t>(1, std::min<std::size_t>(MAX_CHUNK_SIZE, table_count / (m_thread_count * 8)));
+        const auto chunk_count = (table_count + chunk_size - 1) / chunk_size;
+        const auto thread_count = std::min(m_thread_count, chunk_count);
+
+        // each chunk is written by a single worker
+        std::vector<parse_result_vector_type> chunk_results(chunk_count);
+        std::atomic<std::size_t> next_chunk(0);
+        std::atomic<bool> failed(false);
+        std::vector<std::exception_ptr> worker_errors(thread_count);
+
+        auto worker_function = [&](std::size_t worker_index) {
+            try
+            {
+                worker_type worker(m_root_snapshot_ptr);
+                while (!failed.load(std::memory_order_relaxed))
+                {
+                    auto chunk_index = next_chunk.fetch_add(1, std::memory_order_relaxed);
+                    if (chunk_index >= chunk_count)
+                    {
+                        break;
+                    }
+
+                    auto chunk_first = chunk_index * chunk_size;
+                    auto chunk_last = std::min(chunk_first + chunk_size, table_count);
+
+                    auto& results = chunk_results[chunk_index];
+                    results.reserve(chunk_last - chunk_first);
+                    for (auto i = chunk_first; i < chunk_last; ++i)
+                    {
+                        results.push_back(worker.parse(first[i]));
+                    }
+                }
+            }
+            catch (...)
+            {
+                worker_errors[worker_index] = std::current_exception();
+                failed = true;
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count - 1);
+        try
+        {
+            for (std::size_t i = 1; i < thread_count; ++i)
+            {
+                threads.emplace_back(worker_function, i);
+            }
+        }
+        catch (...)
+        {
+            // continue with the threads already started
+        }
+
+        worker_function(0);
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (auto& error : worker_errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        parse_result_vector_type results;
+        results.reserve(table_count);
+        for (auto& chunk : chunk_results)
+        {
+            std::move(chunk.begin(), chunk.end(), std::back_inserter(results));
+        }
+        return results;
+    }
+
+private:
+    /// \brief Per-thread parsing state
+    class worker_type
+    {
+    public:
+        explicit worker_type(const const_snapshot_ptr_type& root_snapshot_ptr)
+            : m_owner_ptr(std::make_shared<const_snapshot_ptr_type>(root_snapshot_ptr))
+            , m_snapshot_ptr(m_owner_ptr, root_snapshot_ptr.get())
+            , m_storage_helper()
+        {
+            // noop
+        }
+
+        parse_result_type parse(const argument_table_type& arg_table)
+        {
+            engine_type engine(
+                arg_table, m_storage_helper, m_snapshot_ptr, m_snapshot_ptr->create_results_data(m_snapshot_ptr));
+            return engine.try_parse();
+        }
+
+    private:
+        using engine_type = basic_parser_engine<char_type, values_storage_type>;
+        using storage_helper_type = typename engine_type::storage_helper_type;
+
+        /// Private owner of the snapshot reference (reference counted by this worker only).
+        std::shared_ptr<const const_snapshot_ptr_type> m_owner_ptr;
+        /// Snapshot pointer sharing ownership with the private owner.
+        const_snapshot_ptr_type m_snapshot_ptr;
+        /// Storage helper (parsers without values storage only).
+        storage_helper_type m_storage_helper;
+    };
+
+    const_snapshot_ptr_type m_root_snapshot_ptr;
+    std::size_t m_thread_count;
+};
+
+template <typename char_T, typename values_storage_T>
+const std::size_t basic_batch_parser_engine<char_T, values_storage_T>::MAX_CHUNK_SIZE;
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_BATCH_PARSER_ENGINE_HPP_
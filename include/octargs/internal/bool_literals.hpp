@@ -0,0 +1,92 @@
+#ifndef OCTARGS_BOOL_LITERALS_HPP_
+#define OCTARGS_BOOL_LITERALS_HPP_
+
+#include <string>
+#include <vector>
+
+#include "../string_view.hpp"
+#include "name_index.hpp"
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+/// \brief Compares chars with ASCII literal (usable in constant expressions)
+template <typename char_T>
+constexpr bool equal_ascii(const char_T* data, const char* literal, std::size_t size)
+{
+    return (size == 0)
+        || ((data[0] == static_cast<char_T>(literal[0])) && equal_ascii(data + 1, literal + 1, size - 1));
+}
+
+/// \brief Matches default dictionary bool literals (usable in constant expressions)
+///
+/// Returns 1 for true literals (true, 1, yes), 0 for false literals
+/// (false, 0, no) and -1 for any other value. Literals are case sensitive.
+template <typename char_T>
+constexpr int match_default_bool_literal(const char_T* data, std::size_t size)
+{
+    return ((size == 4) && equal_ascii(data, "true", 4)) || ((size == 1) && equal_ascii(data, "1", 1))
+            || ((size == 3) && equal_ascii(data, "yes", 3))
+        ? 1
+        : ((size == 5) && equal_ascii(data, "false", 5)) || ((size == 1) && equal_ascii(data, "0", 1))
+            || ((size == 2) && equal_ascii(data, "no", 2))
+        ? 0
+        : -1;
+}
+
+/// \brief Precompiled table of bool literals
+///
+/// Literals are hashed (see basic_name_index) so matching a value costs a
+/// single lookup regardless of the number of literals. If a literal is both
+/// in true and false literals, the true literal takes precedence.
+///
+/// \tparam char_T      char type (as in std::basic_string)
+template <typename char_T>
+class basic_bool_literal_matcher
+{
+public:
+    using char_type = char_T;
+
+    using string_type = std::basic_string<char_type>;
+    using string_vector_type = std::vector<string_type>;
+    using string_view_type = basic_string_view<char_type>;
+
+    basic_bool_literal_matcher(
+        bool case_sensitive, const string_vector_type& true_literals, const string_vector_type& false_literals)
+        : m_literals_index(case_sensitive)
+    {
+        for (auto& literal : true_literals)
+        {
+            m_literals_index.insert(literal, true);
+        }
+        for (auto& literal : false_literals)
+        {
+            m_literals_index.insert(literal, false);
+        }
+    }
+
+    /// \brief Returns true if value is a literal and sets the result to the literal meaning
+    bool match(string_view_type value, bool& result) const
+    {
+        auto result_ptr = m_literals_index.find(value);
+        if (!result_ptr)
+        {
+            return false;
+        }
+        result = *result_ptr;
+        return true;
+    }
+
+private:
+    basic_name_index<char_type, bool> m_literals_index;
+};
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_BOOL_LITERALS_HPP_
@@ -0,0 +1,119 @@
+#ifndef OCTARGS_CASE_FOLDING_HPP_
+#define OCTARGS_CASE_FOLDING_HPP_
+
+#include <cstddef>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "char_utils.hpp"
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+/// \brief Copies the chars folding their case (see fold_case())
+template <typename char_T>
+inline void fold_case_copy(const char_T* src, std::size_t size, char_T* dst)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        dst[i] = fold_case(src[i]);
+    }
+}
+
+/// \brief Compares the chars ignoring case (see fold_case())
+template <typename char_T>
+inline bool equal_ignore_case(const char_T* str1, const char_T* str2, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (fold_case(str1[i]) != fold_case(str2[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if defined(__SSE2__)
+
+namespace sse2
+{
+
+const std::size_t BLOCK_SIZE = 16;
+
+inline __m128i load_block(const char* data)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+inline bool is_ascii_block(__m128i block)
+{
+    return _mm_movemask_epi8(block) == 0;
+}
+
+/// Folds block of ASCII chars.
+inline __m128i fold_ascii_block(__m128i block)
+{
+    auto is_upper = _mm_and_si128(
+        _mm_cmpgt_epi8(block, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8('Z' + 1)));
+    return _mm_or_si128(block, _mm_and_si128(is_upper, _mm_set1_epi8('a' - 'A')));
+}
+
+} // namespace sse2
+
+/// \brief Copies the chars folding their case - ASCII blocks are folded with SSE2
+inline void fold_case_copy(const char* src, std::size_t size, char* dst)
+{
+    std::size_t i = 0;
+    for (; i + sse2::BLOCK_SIZE <= size; i += sse2::BLOCK_SIZE)
+    {
+        auto block = sse2::load_block(src + i);
+        if (sse2::is_ascii_block(block))
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), sse2::fold_ascii_block(block));
+        }
+        else
+        {
+            fold_case_copy<char>(src + i, sse2::BLOCK_SIZE, dst + i);
+        }
+    }
+    fold_case_copy<char>(src + i, size - i, dst + i);
+}
+
+/// \brief Compares the chars ignoring case - ASCII blocks are compared with SSE2
+inline bool equal_ignore_case(const char* str1, const char* str2, std::size_t size)
+{
+    std::size_t i = 0;
+    for (; i + sse2::BLOCK_SIZE <= size; i += sse2::BLOCK_SIZE)
+    {
+        auto block1 = sse2::load_block(str1 + i);
+        auto block2 = sse2::load_block(str2 + i);
+        if (sse2::is_ascii_block(_mm_or_si128(block1, block2)))
+        {
+            auto equal = _mm_cmpeq_epi8(sse2::fold_ascii_block(block1), sse2::fold_ascii_block(block2));
+            if (_mm_movemask_epi8(equal) != 0xFFFF)
+            {
+                return false;
+            }
+        }
+        else if (!equal_ignore_case<char>(str1 + i, str2 + i, sse2::BLOCK_SIZE))
+        {
+            return false;
+        }
+    }
+    return equal_ignore_case<char>(str1 + i, str2 + i, size - i);
+}
+
+#endif // __SSE2__
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_CASE_FOLDING_HPP_
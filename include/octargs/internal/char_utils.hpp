@@ -31,6 +31,29 @@ inline wchar_t to_lower(wchar_t c)
     return std::towlower(c);
 }
 
+inline bool is_ascii(char c)
+{
+    return static_cast<unsigned char>(c) < 0x80;
+}
+
+inline bool is_ascii(wchar_t c)
+{
+    return (c >= 0) && (c < 0x80);
+}
+
+/// \brief Case folding used for case insensitive names and values
+///
+/// ASCII chars are folded directly, other chars with locale-aware to_lower().
+template <typename char_T>
+inline char_T fold_case(char_T c)
+{
+    if (is_ascii(c))
+    {
+        return ((c >= 'A') && (c <= 'Z')) ? static_cast<char_T>(c + ('a' - 'A')) : c;
+    }
+    return to_lower(c);
+}
+
 } // namespace internal
 } // namespace args
 } // namespace oct
@@ -27,8 +27,10 @@ public:
 
     using parser_data_weak_ptr_type = typename base_type::parser_data_weak_ptr_type;
 
-    explicit basic_exclusive_argument_impl(parser_data_weak_ptr_type parser_data_ptr, const string_vector_type& names)
-        : base_type(parser_data_ptr, base_type::FLAG_IS_EXCLUSIVE | base_type::FLAG_IS_ASSIGNABLE_BY_NAME, names)
+    explicit basic_exclusive_argument_impl(
+        parser_data_weak_ptr_type parser_data_ptr, std::size_t slot, const string_vector_type& names)
+        : base_type(
+            parser_data_ptr, slot, base_type::FLAG_IS_EXCLUSIVE | base_type::FLAG_IS_ASSIGNABLE_BY_NAME, names)
     {
         // noop
     }
@@ -0,0 +1,178 @@
+#ifndef OCTARGS_FILE_MAPPING_HPP_
+#define OCTARGS_FILE_MAPPING_HPP_
+
+#include <memory>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define OCTARGS_FILE_MAPPING_MMAP
+#endif
+
+#if !defined(OCTARGS_FILE_MAPPING_MMAP)
+#include <fstream>
+#include <iterator>
+#include <vector>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+/// \brief Read only view of the whole file contents
+///
+/// On POSIX systems the file is memory mapped, on other systems it is read
+/// into a buffer using standard streams.
+class file_mapping
+{
+public:
+    /// \brief File identifier (used to detect the same file opened using different paths)
+    class file_id
+    {
+    public:
+        file_id()
+            : m_device(0)
+            , m_inode(0)
+            , m_path()
+        {
+            // noop
+        }
+
+        bool operator==(const file_id& other) const
+        {
+            return (m_device == other.m_device) && (m_inode == other.m_inode) && (m_path == other.m_path);
+        }
+
+        unsigned long long m_device;
+        unsigned long long m_inode;
+        std::string m_path;
+    };
+
+    file_mapping(const file_mapping&) = delete;
+    file_mapping& operator=(const file_mapping&) = delete;
+
+    ~file_mapping()
+    {
+#if defined(OCTARGS_FILE_MAPPING_MMAP)
+        if (m_size > 0)
+        {
+            munmap(const_cast<char*>(m_data), m_size);
+        }
+#endif
+    }
+
+    /// \brief Opens the file, returns nullptr if the file could not be read
+    static std::shared_ptr<const file_mapping> open(const std::string& path)
+    {
+        std::shared_ptr<file_mapping> mapping(new file_mapping());
+        if (!mapping->map(path))
+        {
+            return nullptr;
+        }
+        return mapping;
+    }
+
+    const char* data() const
+    {
+        return m_data;
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    const file_id& get_id() const
+    {
+        return m_id;
+    }
+
+private:
+    file_mapping()
+        : m_data(nullptr)
+        , m_size(0)
+        , m_id()
+#if !defined(OCTARGS_FILE_MAPPING_MMAP)
+        , m_buffer()
+#endif
+    {
+        // noop
+    }
+
+#if !defined(OCTARGS_FILE_MAPPING_MMAP)
+    bool map(const std::string& path)
+    {
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+        if (!stream)
+        {
+            return false;
+        }
+
+        m_buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        if (stream.bad())
+        {
+            return false;
+        }
+
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+        m_id.m_path = path;
+        return true;
+    }
+#else
+    bool map(const std::string& path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        struct stat file_stat;
+        if ((fstat(fd, &file_stat) != 0) || !S_ISREG(file_stat.st_mode))
+        {
+            ::close(fd);
+            return false;
+        }
+
+        m_id.m_device = static_cast<unsigned long long>(file_stat.st_dev);
+        m_id.m_inode = static_cast<unsigned long long>(file_stat.st_ino);
+
+        auto size = static_cast<std::size_t>(file_stat.st_size);
+        if (size > 0)
+        {
+            void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                ::close(fd);
+                return false;
+            }
+            m_data = static_cast<const char*>(data);
+            m_size = size;
+        }
+
+        ::close(fd);
+        return true;
+    }
+#endif
+
+    const char* m_data;
+    std::size_t m_size;
+    file_id m_id;
+#if !defined(OCTARGS_FILE_MAPPING_MMAP)
+    std::vector<char> m_buffer;
+#endif
+};
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_FILE_MAPPING_HPP_
@@ -0,0 +1,119 @@
+#ifndef OCTARGS_FIRST_CHAR_FILTER_HPP_
+#define OCTARGS_FIRST_CHAR_FILTER_HPP_
+
+#include <bitset>
+#include <string>
+#include <type_traits>
+
+#include "../string_view.hpp"
+#include "char_utils.hpp"
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+/// \brief Set of first characters of names
+///
+/// Allows to reject values that cannot start with any of the registered names
+/// (i.e. positional values when all names use the dictionary prefixes) with a
+/// single bit test, without searching for the value separator and looking up
+/// the name. Characters outside of the bitmap range are not filtered (any of
+/// them matches if any name starts with such character). For case insensitive
+/// filters all the characters with the same folded case are marked, so values
+/// are tested without normalization.
+///
+/// \tparam char_T      char type (as in std::basic_string)
+template <typename char_T>
+class basic_first_char_filter
+{
+public:
+    using char_type = char_T;
+
+    using string_type = std::basic_string<char_type>;
+    using string_view_type = basic_string_view<char_type>;
+
+    explicit basic_first_char_filter(bool case_sensitive)
+        : m_case_sensitive(case_sensitive)
+        , m_chars()
+        , m_has_other_chars(false)
+    {
+        // noop
+    }
+
+    void insert(const string_type& name)
+    {
+        if (name.empty())
+        {
+            return;
+        }
+
+        auto c = to_unsigned(name[0]);
+        if (c >= CHAR_COUNT)
+        {
+            m_has_other_chars = true;
+        }
+        else if (m_case_sensitive)
+        {
+            m_chars.set(c);
+        }
+        else
+        {
+            // mark all the chars folded to the same char, so lookup does not need to normalize
+            auto folded_c = fold_case(name[0]);
+            for (std::size_t i = 0; i < CHAR_COUNT; ++i)
+            {
+                if (fold_case(static_cast<char_type>(i)) == folded_c)
+                {
+                    m_chars.set(i);
+                }
+            }
+            if ((c >= ASCII_CHAR_COUNT) || (sizeof(char_type) > 1))
+            {
+                // chars outside of bitmap may have the same lower case
+                m_has_other_chars = true;
+            }
+        }
+    }
+
+    /// \brief Returns false if no name is a prefix of the given value
+    bool may_match(string_view_type value) const
+    {
+        if (value.empty())
+        {
+            return false;
+        }
+
+        auto c = to_unsigned(value[0]);
+        return (c < CHAR_COUNT) ? m_chars.test(c) : m_has_other_chars;
+    }
+
+private:
+    using unsigned_char_type = typename std::make_unsigned<char_type>::type;
+
+    static const std::size_t CHAR_COUNT = 256;
+    static const std::size_t ASCII_CHAR_COUNT = 128;
+
+    static std::size_t to_unsigned(char_type c)
+    {
+        return static_cast<unsigned_char_type>(c);
+    }
+
+    bool m_case_sensitive;
+    std::bitset<CHAR_COUNT> m_chars;
+    bool m_has_other_chars;
+};
+
+template <typename char_T>
+const std::size_t basic_first_char_filter<char_T>::CHAR_COUNT;
+
+template <typename char_T>
+const std::size_t basic_first_char_filter<char_T>::ASCII_CHAR_COUNT;
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_FIRST_CHAR_FILTER_HPP_
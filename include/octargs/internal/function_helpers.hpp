@@ -43,6 +43,31 @@ public:
 
         return [func](const dictionary_type& /*dictionary*/, const string_type& value_str) { return func(value_str); };
     }
+
+    /// \brief Calls converter object directly (without std::function wrapping)
+    template <typename converter_T>
+    static data_type invoke(
+        const converter_T& converter, const dictionary_type& dictionary, const string_type& value_str)
+    {
+        return invoke_internal(converter, dictionary, value_str, 0);
+    }
+
+private:
+    template <typename converter_T>
+    static auto invoke_internal(
+        const converter_T& converter, const dictionary_type& dictionary, const string_type& value_str, int)
+        -> decltype(converter(dictionary, value_str))
+    {
+        return converter(dictionary, value_str);
+    }
+
+    template <typename converter_T>
+    static auto invoke_internal(
+        const converter_T& converter, const dictionary_type& /*dictionary*/, const string_type& value_str, long)
+        -> decltype(converter(value_str))
+    {
+        return converter(value_str);
+    }
 };
 
 template <typename char_T, typename data_T>
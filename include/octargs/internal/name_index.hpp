@@ -0,0 +1,230 @@
+#ifndef OCTARGS_NAME_INDEX_HPP_
+#define OCTARGS_NAME_INDEX_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../string_view.hpp"
+#include "case_folding.hpp"
+#include "char_utils.hpp"
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+/// \brief Hash based name to value index
+///
+/// Open addressing (linear probing) hash table. For case insensitive indexes
+/// the keys are stored already normalized (case folded) so lookup folds the
+/// searched name once (into a stack buffer, see fold_case_copy()) and then
+/// hashes and compares the folded chars. Names longer than the longest key
+/// are rejected without hashing.
+///
+/// \tparam char_T      char type (as in std::basic_string)
+/// \tparam value_T     type of indexed values
+template <typename char_T, typename value_T>
+class basic_name_index
+{
+public:
+    using char_type = char_T;
+    using value_type = value_T;
+
+    using string_type = std::basic_string<char_type>;
+    using string_view_type = basic_string_view<char_type>;
+
+    explicit basic_name_index(bool case_sensitive)
+        : m_case_sensitive(case_sensitive)
+        , m_size(0)
+        , m_max_key_size(0)
+        , m_entries()
+    {
+        // noop
+    }
+
+    bool is_case_sensitive() const
+    {
+        return m_case_sensitive;
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    bool insert(const string_type& name, const value_type& value)
+    {
+        if ((m_size + 1) * 2 > m_entries.size())
+        {
+            rehash(m_entries.empty() ? MIN_CAPACITY : m_entries.size() * 2);
+        }
+
+        string_type key(name.size(), char_type());
+        normalize(name.data(), name.size(), &key[0]);
+
+        auto hash = compute_hash(key.data(), key.size());
+        auto& entry = m_entries[find_position(key.data(), key.size(), hash)];
+        if (entry.m_used)
+        {
+            return false;
+        }
+
+        entry.m_used = true;
+        entry.m_hash = hash;
+        entry.m_key = std::move(key);
+        entry.m_value = value;
+
+        ++m_size;
+        m_max_key_size = std::max(m_max_key_size, name.size());
+
+        return true;
+    }
+
+    const value_type* find(const char_type* data, std::size_t size) const
+    {
+        if ((m_size == 0) || (size > m_max_key_size))
+        {
+            return nullptr;
+        }
+
+        if (m_case_sensitive)
+        {
+            return find_normalized(data, size);
+        }
+        else if (size <= FOLD_BUFFER_SIZE)
+        {
+            char_type folded[FOLD_BUFFER_SIZE];
+            normalize(data, size, folded);
+            return find_normalized(folded, size);
+        }
+        else
+        {
+            string_type folded(size, char_type());
+            normalize(data, size, &folded[0]);
+            return find_normalized(folded.data(), size);
+        }
+    }
+
+    const value_type* find(string_view_type name) const
+    {
+        return find(name.data(), name.size());
+    }
+
+private:
+    struct entry
+    {
+        entry()
+            : m_used(false)
+            , m_hash(0)
+            , m_key()
+            , m_value()
+        {
+            // noop
+        }
+
+        bool m_used;
+        std::size_t m_hash;
+        string_type m_key;
+        value_type m_value;
+    };
+
+    using unsigned_char_type = typename std::make_unsigned<char_type>::type;
+
+    static const std::size_t MIN_CAPACITY = 16;
+    static const std::size_t FOLD_BUFFER_SIZE = 64;
+
+    static const std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    static const std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+    void normalize(const char_type* data, std::size_t size, char_type* normalized) const
+    {
+        if (m_case_sensitive)
+        {
+            std::copy(data, data + size, normalized);
+        }
+        else
+        {
+            fold_case_copy(data, size, normalized);
+        }
+    }
+
+    const value_type* find_normalized(const char_type* data, std::size_t size) const
+    {
+        auto& entry = m_entries[find_position(data, size, compute_hash(data, size))];
+        return entry.m_used ? &entry.m_value : nullptr;
+    }
+
+    std::size_t compute_hash(const char_type* data, std::size_t size) const
+    {
+        std::uint64_t hash = FNV_OFFSET_BASIS;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= static_cast<unsigned_char_type>(data[i]);
+            hash *= FNV_PRIME;
+        }
+        return static_cast<std::size_t>(hash);
+    }
+
+    bool is_matching(const entry& entry, const char_type* data, std::size_t size, std::size_t hash) const
+    {
+        if ((entry.m_hash != hash) || (entry.m_key.size() != size))
+        {
+            return false;
+        }
+        return std::char_traits<char_type>::compare(data, entry.m_key.data(), size) == 0;
+    }
+
+    std::size_t find_position(const char_type* data, std::size_t size, std::size_t hash) const
+    {
+        auto mask = m_entries.size() - 1;
+        auto position = hash & mask;
+        while (m_entries[position].m_used && !is_matching(m_entries[position], data, size, hash))
+        {
+            position = (position + 1) & mask;
+        }
+        return position;
+    }
+
+    void rehash(std::size_t capacity)
+    {
+        std::vector<entry> old_entries(capacity);
+        old_entries.swap(m_entries);
+
+        auto mask = m_entries.size() - 1;
+        for (auto& old_entry : old_entries)
+        {
+            if (!old_entry.m_used)
+            {
+                continue;
+            }
+
+            auto position = old_entry.m_hash & mask;
+            while (m_entries[position].m_used)
+            {
+                position = (position + 1) & mask;
+            }
+            m_entries[position] = std::move(old_entry);
+        }
+    }
+
+    bool m_case_sensitive;
+    std::size_t m_size;
+    std::size_t m_max_key_size;
+    std::vector<entry> m_entries;
+};
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_NAME_INDEX_HPP_
@@ -0,0 +1,218 @@
+#ifndef OCTARGS_NUMBER_UTILS_HPP_
+#define OCTARGS_NUMBER_UTILS_HPP_
+
+#include <cerrno>
+#include <cstdlib>
+#include <cwchar>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include "char_utils.hpp"
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+template <typename char_T>
+inline void trim_range(const char_T*& first, const char_T*& last)
+{
+    while ((first != last) && is_space(*first))
+    {
+        ++first;
+    }
+    while ((last != first) && is_space(*(last - 1)))
+    {
+        --last;
+    }
+}
+
+template <typename char_T>
+inline unsigned int get_digit_value(char_T c)
+{
+    if ((c >= char_T('0')) && (c <= char_T('9')))
+    {
+        return static_cast<unsigned int>(c - char_T('0'));
+    }
+    if ((c >= char_T('a')) && (c <= char_T('f')))
+    {
+        return static_cast<unsigned int>(c - char_T('a')) + 10;
+    }
+    if ((c >= char_T('A')) && (c <= char_T('F')))
+    {
+        return static_cast<unsigned int>(c - char_T('A')) + 10;
+    }
+    return std::numeric_limits<unsigned int>::max();
+}
+
+/// \brief Parses integer value
+///
+/// Parses the value in place without memory allocation and without exceptions.
+/// Leading and trailing white spaces are ignored. The base is detected like
+/// for strtol() with base 0 (0x prefix - hexadecimal, 0 prefix - octal).
+/// Negative values are accepted only for signed types. Returns false if the
+/// value is not valid or out of range.
+template <typename char_T, typename data_T>
+inline bool parse_integer(const char_T* first, const char_T* last, data_T& value)
+{
+    using data_type = data_T;
+    using limits_type = std::numeric_limits<data_type>;
+
+    static_assert(std::is_integral<data_type>::value, "Integer type required");
+    static_assert(sizeof(data_type) <= sizeof(unsigned long long), "Unsupported data type");
+
+    trim_range(first, last);
+
+    bool negative = false;
+    if ((first != last) && ((*first == char_T('-')) || (*first == char_T('+'))))
+    {
+        negative = (*first == char_T('-'));
+        ++first;
+    }
+
+    unsigned int base = 10;
+    if (((last - first) >= 2) && (first[0] == char_T('0')) && ((first[1] == char_T('x')) || (first[1] == char_T('X'))))
+    {
+        base = 16;
+        first += 2;
+    }
+    else if (((last - first) >= 2) && (first[0] == char_T('0')))
+    {
+        base = 8;
+        ++first;
+    }
+
+    if (first == last)
+    {
+        return false;
+    }
+
+    unsigned long long limit = static_cast<unsigned long long>(limits_type::max());
+    if (negative)
+    {
+        limit = limits_type::is_signed ? limit + 1 : 0;
+    }
+
+    unsigned long long result = 0;
+    for (; first != last; ++first)
+    {
+        auto digit = get_digit_value(*first);
+        if (digit >= base)
+        {
+            return false;
+        }
+        if ((result > limit / base) || ((result == limit / base) && (digit > limit % base)))
+        {
+            return false;
+        }
+        result = result * base + digit;
+    }
+
+    if (!negative)
+    {
+        value = static_cast<data_type>(result);
+    }
+    else if (result == 0)
+    {
+        value = 0;
+    }
+    else
+    {
+        // result - 1 always fits the type (avoids overflow for minimum value)
+        value = static_cast<data_type>(-static_cast<data_type>(result - 1) - 1);
+    }
+    return true;
+}
+
+inline float str_to_floating(const char* str, char** end_ptr, float*)
+{
+    return std::strtof(str, end_ptr);
+}
+
+inline double str_to_floating(const char* str, char** end_ptr, double*)
+{
+    return std::strtod(str, end_ptr);
+}
+
+inline long double str_to_floating(const char* str, char** end_ptr, long double*)
+{
+    return std::strtold(str, end_ptr);
+}
+
+inline float str_to_floating(const wchar_t* str, wchar_t** end_ptr, float*)
+{
+    return std::wcstof(str, end_ptr);
+}
+
+inline double str_to_floating(const wchar_t* str, wchar_t** end_ptr, double*)
+{
+    return std::wcstod(str, end_ptr);
+}
+
+inline long double str_to_floating(const wchar_t* str, wchar_t** end_ptr, long double*)
+{
+    return std::wcstold(str, end_ptr);
+}
+
+/// \brief Parses floating point value
+///
+/// Accepts the same format as strtod(). Leading and trailing white spaces are
+/// ignored. The value is copied to a buffer on stack (strtod() requires null
+/// terminated string), memory is allocated only for very long values. Returns
+/// false if the value is not valid or out of range.
+template <typename char_T, typename data_T>
+inline bool parse_floating_point(const char_T* first, const char_T* last, data_T& value)
+{
+    using char_type = char_T;
+    using data_type = data_T;
+
+    static const std::size_t BUFFER_SIZE = 64;
+
+    trim_range(first, last);
+
+    auto size = static_cast<std::size_t>(last - first);
+    if (size == 0)
+    {
+        return false;
+    }
+
+    char_type buffer[BUFFER_SIZE];
+    std::basic_string<char_type> long_buffer;
+
+    const char_type* str = buffer;
+    if (size < BUFFER_SIZE)
+    {
+        std::char_traits<char_type>::copy(buffer, first, size);
+        buffer[size] = char_type();
+    }
+    else
+    {
+        long_buffer.assign(first, last);
+        str = long_buffer.c_str();
+    }
+
+    char_type* end_ptr = nullptr;
+
+    auto saved_errno = errno;
+    errno = 0;
+    auto result = str_to_floating(str, &end_ptr, static_cast<data_type*>(nullptr));
+    auto result_errno = errno;
+    errno = saved_errno;
+
+    if ((end_ptr != str + size) || (result_errno == ERANGE))
+    {
+        return false;
+    }
+
+    value = result;
+    return true;
+}
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_NUMBER_UTILS_HPP_
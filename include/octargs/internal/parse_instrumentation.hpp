@@ -0,0 +1,215 @@
+#ifndef OCTARGS_PARSE_INSTRUMENTATION_HPP_
+#define OCTARGS_PARSE_INSTRUMENTATION_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "../parse_observer.hpp"
+#include "../parse_visitor.hpp"
+#include "../string_view.hpp"
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+/// \brief Parser engine instrumentation reporting events to parse observer
+///
+/// Events are reported (and clocks are read) only if the parser has an
+/// observer set, otherwise each instrumentation point costs a null check.
+/// The instrumentation is the same in all translation units (there is no
+/// compile time switch changing the parser engine definition).
+///
+/// \tparam char_T              char type (as in std::basic_string)
+template <typename char_T>
+class basic_parse_instrumentation
+{
+public:
+    using char_type = char_T;
+
+    using string_type = std::basic_string<char_type>;
+    using string_vector_type = std::vector<string_type>;
+    using string_view_type = basic_string_view<char_type>;
+
+    using observer_type = basic_parse_observer<char_type>;
+    using clock_type = typename observer_type::clock_type;
+    using duration_type = typename observer_type::duration_type;
+    using argument_handle_type = typename observer_type::argument_handle_type;
+
+    /// \brief Reports the parse duration (from construction to destruction)
+    class parse_scope
+    {
+    public:
+        parse_scope(const basic_parse_instrumentation& instrumentation, std::size_t token_count)
+            : m_observer(instrumentation.m_observer)
+            , m_start()
+            , m_succeeded(false)
+        {
+            if (is_active(m_observer))
+            {
+                m_observer->on_parse_begin(token_count);
+                m_start = clock_type::now();
+            }
+        }
+
+        parse_scope(const parse_scope&) = delete;
+        parse_scope& operator=(const parse_scope&) = delete;
+
+        ~parse_scope()
+        {
+            if (is_active(m_observer))
+            {
+                m_observer->on_parse_end(m_succeeded, clock_type::now() - m_start);
+            }
+        }
+
+        void set_succeeded(bool succeeded)
+        {
+            m_succeeded = succeeded;
+        }
+
+    private:
+        observer_type* m_observer;
+        typename clock_type::time_point m_start;
+        bool m_succeeded;
+    };
+
+    /// \brief Reports the phase duration (on end() call or destruction)
+    class phase_scope
+    {
+    public:
+        phase_scope(const basic_parse_instrumentation& instrumentation, parse_phase phase)
+            : m_observer(instrumentation.m_observer)
+            , m_phase(phase)
+            , m_start(is_active(m_observer) ? clock_type::now() : typename clock_type::time_point())
+        {
+            // noop
+        }
+
+        phase_scope(const phase_scope&) = delete;
+        phase_scope& operator=(const phase_scope&) = delete;
+
+        ~phase_scope()
+        {
+            end();
+        }
+
+        void end()
+        {
+            if (is_active(m_observer))
+            {
+                m_observer->on_phase(m_phase, clock_type::now() - m_start);
+                m_observer = nullptr;
+            }
+        }
+
+    private:
+        observer_type* m_observer;
+        parse_phase m_phase;
+        typename clock_type::time_point m_start;
+    };
+
+    /// \brief Reports the argument call duration to the observer callback (on destruction)
+    template <typename argument_T>
+    class argument_scope
+    {
+    public:
+        using callback_type = void (observer_type::*)(const argument_handle_type&, duration_type);
+
+        argument_scope(
+            const basic_parse_instrumentation& instrumentation, const argument_T& argument, callback_type callback)
+            : m_observer(instrumentation.m_observer)
+            , m_qualified_names(instrumentation.m_qualified_names)
+            , m_argument(argument)
+            , m_callback(callback)
+            , m_start(is_active(m_observer) ? clock_type::now() : typename clock_type::time_point())
+        {
+            // noop
+        }
+
+        argument_scope(const argument_scope&) = delete;
+        argument_scope& operator=(const argument_scope&) = delete;
+
+        ~argument_scope()
+        {
+            if (is_active(m_observer))
+            {
+                auto duration = clock_type::now() - m_start;
+                auto& qualified_name = (*m_qualified_names)[m_argument.get_slot()];
+                (m_observer->*m_callback)(argument_handle_type(m_argument, qualified_name), duration);
+            }
+        }
+
+    private:
+        observer_type* m_observer;
+        const string_vector_type* m_qualified_names;
+        const argument_T& m_argument;
+        callback_type m_callback;
+        typename clock_type::time_point m_start;
+    };
+
+    /// \brief Reports the converter call duration (on destruction)
+    template <typename argument_T>
+    class converter_scope : public argument_scope<argument_T>
+    {
+    public:
+        converter_scope(const basic_parse_instrumentation& instrumentation, const argument_T& argument)
+            : argument_scope<argument_T>(instrumentation, argument, &observer_type::on_converter_call)
+        {
+            // noop
+        }
+    };
+
+    /// \brief Reports the argument handler (check and store functions) call duration (on destruction)
+    template <typename argument_T>
+    class handler_scope : public argument_scope<argument_T>
+    {
+    public:
+        handler_scope(const basic_parse_instrumentation& instrumentation, const argument_T& argument)
+            : argument_scope<argument_T>(instrumentation, argument, &observer_type::on_handler_call)
+        {
+            // noop
+        }
+    };
+
+    /// Qualified names are the arguments names with subparser prefixes by slot (reported to the observer).
+    basic_parse_instrumentation(observer_type* observer, const string_vector_type& qualified_names)
+        : m_observer(observer)
+        , m_qualified_names(&qualified_names)
+    {
+        // noop
+    }
+
+    /// \brief Checks if events are reported (i.e. if timings shall be taken)
+    bool is_active() const
+    {
+        return is_active(m_observer);
+    }
+
+    void name_lookup(string_view_type name, bool found) const
+    {
+        if (is_active(m_observer))
+        {
+            m_observer->on_name_lookup(name, found);
+        }
+    }
+
+private:
+    /// \brief Checks if events shall be reported (observer is set)
+    static bool is_active(const observer_type* observer)
+    {
+        return observer != nullptr;
+    }
+
+    observer_type* m_observer;
+    const string_vector_type* m_qualified_names;
+};
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_PARSE_INSTRUMENTATION_HPP_
@@ -7,9 +7,11 @@
 #include <vector>
 
 #include "../argument_group.hpp"
+#include "../parse_observer.hpp"
 #include "argument.hpp"
 #include "argument_repository.hpp"
 #include "memory.hpp"
+#include "parser_tree_state.hpp"
 
 namespace oct
 {
@@ -18,6 +20,10 @@ namespace args
 namespace internal
 {
 
+// forward
+template <typename char_T, typename values_storage_T>
+class basic_parser_snapshot;
+
 template <typename char_T, typename values_storage_T>
 class basic_parser_data : public enable_shared_from_this<basic_parser_data<char_T, values_storage_T>>
 {
@@ -49,8 +55,16 @@ public:
 
     using parser_data_ptr_type = std::shared_ptr<basic_parser_data>;
 
+    using tree_state_ptr_type = std::shared_ptr<parser_tree_state>;
+
+    using parse_observer_type = basic_parse_observer<char_type>;
+    using parse_observer_ptr_type = std::shared_ptr<parse_observer_type>;
+
     using parsers_map_type = std::map<string_type, parser_data_ptr_type, string_less_type>;
 
+    using snapshot_type = basic_parser_snapshot<char_type, values_storage_type>;
+    using const_snapshot_ptr_type = std::shared_ptr<const snapshot_type>;
+
     argument_group_type add_group(const std::string& name)
     {
         auto argument_group_impl = std::make_shared<argument_group_impl_type>(this->weak_from_this(), name);
@@ -92,7 +106,7 @@ public:
             throw invalid_parser_name_ex<char_type>("Duplicated parser name", name);
         }
 
-        auto subparser_data = create(m_dictionary);
+        auto subparser_data = create(m_dictionary, m_tree_state);
 
         auto result = m_subparsers.emplace(name, subparser_data);
         if (!result.second)
@@ -100,6 +114,8 @@ public:
             throw std::runtime_error("Cannot emplace new parser");
         }
 
+        m_tree_state->mark_modified();
+
         return result.first->second;
     }
 
@@ -133,6 +149,7 @@ public:
         return *m_default_argument_group_ptr;
     }
 
+    tree_state_ptr_type m_tree_state;
     const_dictionary_ptr_type m_dictionary;
     argument_repository_ptr_type m_argument_repository;
 
@@ -140,31 +157,44 @@ public:
     string_type m_usage_oneliner;
     string_type m_usage_header;
     string_type m_usage_footer;
+    parse_observer_ptr_type m_parse_observer;
+
+    /// Snapshot cache (see basic_parser_snapshot::get()), accessed atomically.
+    const_snapshot_ptr_type m_snapshot;
 
     static std::shared_ptr<basic_parser_data> create(const const_dictionary_ptr_type& dictionary)
+    {
+        return create(dictionary, std::make_shared<parser_tree_state>());
+    }
+
+    static std::shared_ptr<basic_parser_data> create(
+        const const_dictionary_ptr_type& dictionary, const tree_state_ptr_type& tree_state)
     {
         struct create_enabler : public basic_parser_data
         {
-            create_enabler(const const_dictionary_ptr_type& dictionary)
-                : basic_parser_data(dictionary)
+            create_enabler(const const_dictionary_ptr_type& dictionary, const tree_state_ptr_type& tree_state)
+                : basic_parser_data(dictionary, tree_state)
             {
                 // noop
             }
         };
 
-        auto new_data = std::make_shared<create_enabler>(dictionary);
+        auto new_data = std::make_shared<create_enabler>(dictionary, tree_state);
         new_data->init();
         return new_data;
     }
 
 private:
-    basic_parser_data(const const_dictionary_ptr_type& dictionary)
-        : m_dictionary(check_dictionary(dictionary))
-        , m_argument_repository(std::make_shared<argument_repository_type>(m_dictionary))
+    basic_parser_data(const const_dictionary_ptr_type& dictionary, const tree_state_ptr_type& tree_state)
+        : m_tree_state(tree_state)
+        , m_dictionary(check_dictionary(dictionary))
+        , m_argument_repository(std::make_shared<argument_repository_type>(m_dictionary, m_tree_state))
         , m_argument_groups()
         , m_usage_oneliner()
         , m_usage_header()
         , m_usage_footer()
+        , m_parse_observer()
+        , m_snapshot()
         , m_default_argument_group_ptr()
         , m_subparsers(string_less<char_type>(dictionary->is_case_sensitive()))
     {
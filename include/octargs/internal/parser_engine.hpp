@@ -1,16 +1,27 @@
 #ifndef OCTARGS_PARSER_ENGINE_HPP_
 #define OCTARGS_PARSER_ENGINE_HPP_
 
+#include <algorithm>
+#include <exception>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "../argument_table.hpp"
 #include "../dictionary.hpp"
 #include "../exception.hpp"
+#include "../parse_result.hpp"
+#include "../parse_visitor.hpp"
 #include "../parser_error.hpp"
 #include "../results.hpp"
+#include "../string_view.hpp"
+#include "../validation_result.hpp"
 
 #include "argument.hpp"
+#include "parse_instrumentation.hpp"
+#include "parser_snapshot.hpp"
+#include "typed_value.hpp"
 
 namespace oct
 {
@@ -19,405 +30,989 @@ namespace args
 namespace internal
 {
 
-template <typename char_T, typename values_storage_T>
-class basic_parser_engine
+/// \brief Parser error description
+///
+/// Name and value are views (of parser definition or arguments table).
+template <typename char_T>
+class basic_parser_error_info
+{
+public:
+    using char_type = char_T;
+
+    using string_view_type = basic_string_view<char_type>;
+
+    static const std::size_t NO_INDEX = static_cast<std::size_t>(-1);
+
+    basic_parser_error_info()
+        : m_code()
+        , m_index(NO_INDEX)
+        , m_name()
+        , m_value()
+        , m_nested_exception()
+    {
+        // noop
+    }
+
+    /// \brief Throws parser_error_ex (with nested conversion error thrown by converter if any)
+    [[noreturn]] void throw_exception() const
+    {
+        parser_error_ex<char_type> exception(m_code, m_name.to_string(), m_value.to_string());
+        if (m_nested_exception)
+        {
+            try
+            {
+                std::rethrow_exception(m_nested_exception);
+            }
+            catch (...)
+            {
+                std::throw_with_nested(exception);
+            }
+        }
+        throw exception;
+    }
+
+    parser_error_code m_code;
+    std::size_t m_index;
+    string_view_type m_name;
+    string_view_type m_value;
+    /// Conversion error thrown by custom converter (if any).
+    std::exception_ptr m_nested_exception;
+};
+
+template <typename char_T>
+const std::size_t basic_parser_error_info<char_T>::NO_INDEX;
+
+/// \brief Parser engine core
+///
+/// Parses the arguments table and passes each accepted value to the sink.
+/// The sink (see basic_results_sink and basic_visitor_sink) counts the values
+/// of each argument and stores or forwards them.
+///
+/// Parsing errors are not thrown - functions return false and the error is
+/// described by get_error(). Only exceptions thrown by custom converters and
+/// check functions are caught (conversion_error) or passed through.
+///
+/// Handlers are called through the storage helper (see storage_handler_helper
+/// and validation_handler_helper).
+template <typename char_T, typename values_storage_T, typename sink_T,
+    typename storage_helper_T = storage_handler_helper<char_T, values_storage_T>>
+class basic_parser_engine_core
 {
 public:
     using char_type = char_T;
     using values_storage_type = values_storage_T;
+    using sink_type = sink_T;
 
     using string_type = std::basic_string<char_type>;
+    using string_view_type = basic_string_view<char_type>;
 
     using argument_table_type = basic_argument_table<char_type>;
-    using results_type = basic_results<char_type>;
 
-    using storage_helper_type = storage_handler_helper<char_type, values_storage_type>;
+    using storage_helper_type = storage_helper_T;
 
-    using parser_data_type = basic_parser_data<char_type, values_storage_type>;
-    using parser_data_ptr_type = std::shared_ptr<parser_data_type>;
+    using snapshot_type = basic_parser_snapshot<char_type, values_storage_type>;
+    using default_values_entry_type = typename snapshot_type::default_values_entry;
 
-    basic_parser_engine(const argument_table_type& arg_table, storage_helper_type& storage_helper,
-        const parser_data_ptr_type& root_parser_data_ptr)
+    using error_info_type = basic_parser_error_info<char_type>;
+
+    using instrumentation_type = basic_parse_instrumentation<char_type>;
+
+    basic_parser_engine_core(const argument_table_type& arg_table, storage_helper_type& storage_helper,
+        const snapshot_type& root_snapshot, sink_type& sink)
         : m_arg_table(arg_table)
         , m_storage_helper(storage_helper)
-        , m_root_parser_data_ptr(root_parser_data_ptr)
-        , m_results_data_ptr(prepare_results_data(root_parser_data_ptr, m_arg_table.get_app_name()))
+        , m_root_snapshot(root_snapshot)
+        , m_sink(sink)
+        , m_error()
+        , m_instrumentation(root_snapshot.get_parse_observer(), root_snapshot.get_qualified_names())
     {
         // noop
     }
 
-    results_type parse()
+    /// \brief Parses the arguments, returns false on error (see get_error())
+    bool parse()
     {
-        argument_table_iterator exclusive_input_iterator(m_arg_table);
+        typename instrumentation_type::parse_scope parse_scope(m_instrumentation, m_arg_table.get_argument_count());
 
-        if (!parse_exclusive_recursively(m_root_parser_data_ptr, exclusive_input_iterator))
-        {
-            argument_table_iterator regular_input_iterator(m_arg_table);
+        argument_table_iterator input_iterator(m_arg_table);
 
-            parse_regular(m_root_parser_data_ptr, regular_input_iterator);
-        }
-        return results_type(m_root_parser_data_ptr->m_dictionary, m_results_data_ptr);
+        auto succeeded = parse_leading(m_root_snapshot, input_iterator, nullptr);
+        parse_scope.set_succeeded(succeeded);
+        return succeeded;
     }
 
-private:
-    using results_data_type = basic_results_data<char_type>;
-    using results_data_ptr_type = std::shared_ptr<results_data_type>;
+    const error_info_type& get_error() const
+    {
+        return m_error;
+    }
 
+private:
     using argument_type = basic_argument<char_type, values_storage_type>;
+    using handler_type = typename argument_type::handler_type;
     using argument_table_iterator = basic_argument_table_iterator<char_type>;
-    using const_argument_ptr_type = std::shared_ptr<const argument_type>;
 
-    static void fill_results_data_names(const results_data_ptr_type& results_data_ptr,
-        const parser_data_ptr_type& parser_data_ptr, const string_type& prefix)
+    using phase_scope_type = typename instrumentation_type::phase_scope;
+    using converter_scope_type = typename instrumentation_type::template converter_scope<argument_type>;
+    using handler_scope_type = typename instrumentation_type::template handler_scope<argument_type>;
+
+    static const std::size_t DEFAULT_VALUE_INDEX = basic_parse_visitor<char_type>::DEFAULT_VALUE_INDEX;
+    static const std::size_t NO_INDEX = error_info_type::NO_INDEX;
+
+    /// Input argument split into name and (immediate) value, resolved to argument.
+    struct named_token
+    {
+        string_view_type m_name;
+        string_view_type m_value;
+        bool m_has_value;
+        const argument_type* m_argument;
+    };
+
+    /// Subparser name taken while all the preceding arguments were subparser
+    /// names as well. Processing of the parser owning the subparsers argument
+    /// (defaults, requirements, subparser name value) is deferred until it is
+    /// known that the arguments do not end with an exclusive argument.
+    struct deferred_subparser
     {
-        for (auto& iter : parser_data_ptr->m_argument_repository->m_names_repository)
+        const snapshot_type& m_snapshot;
+        string_view_type m_value;
+        std::size_t m_value_index;
+        const deferred_subparser* m_parent;
+    };
+
+    /// Parses arguments of the parser reached by subparser names only.
+    ///
+    /// Exclusive argument is accepted only as the last argument preceded by
+    /// subparser names only, so it is detected here at the point it appears.
+    /// Each input argument is resolved once - the resolved first argument is
+    /// reused by the regular parsing.
+    bool parse_leading(
+        const snapshot_type& snapshot, argument_table_iterator& input_iterator, const deferred_subparser* deferred)
+    {
+        // the phase ends before the next parsing step starts (phases are not nested)
+        phase_scope_type phase_scope(m_instrumentation, parse_phase::LEADING_ARGUMENTS);
+
+        if (!input_iterator.has_more())
         {
-            results_data_ptr->add_name(prefix + iter.first, iter.second);
+            phase_scope.end();
+            return parse_deferred(deferred) && parse_regular(snapshot, input_iterator, nullptr);
         }
 
-        if (!parser_data_ptr->m_argument_repository->m_subparsers_argument)
+        auto input_value = input_iterator.peek_next_view();
+        auto token = resolve_named_token(snapshot, input_value);
+
+        if (input_iterator.get_remaining_count() == 1)
         {
-            return;
-        }
+            if (token.m_argument && !token.m_has_value && token.m_argument->is_exclusive())
+            {
+                // exclusive argument - all other arguments processing is skipped
+                auto arg_index = input_iterator.get_index();
+                input_iterator.take_next_view();
+
+                auto value_str = snapshot.get_switch_enabled_literal();
 
-        for (auto& subparser_item : parser_data_ptr->get_subparsers())
+                phase_scope.end();
+                return parse_argument_value(snapshot, *token.m_argument, token.m_name, value_str, arg_index);
+            }
+        }
+        else if (snapshot.get_subparsers_argument() && !token.m_argument)
         {
-            auto new_prefix
-                = prefix + subparser_item.first + parser_data_ptr->m_dictionary->get_subparser_separator_literal();
+            auto subparser_ptr = snapshot.find_subparser(input_value);
+            m_instrumentation.name_lookup(input_value, subparser_ptr != nullptr);
+            if (subparser_ptr)
+            {
+                const deferred_subparser current = { snapshot, input_value, input_iterator.get_index(), deferred };
+                input_iterator.take_next_view();
 
-            fill_results_data_names(results_data_ptr, subparser_item.second, new_prefix);
+                phase_scope.end();
+                return parse_leading(*subparser_ptr, input_iterator, &current);
+            }
         }
+
+        phase_scope.end();
+        return parse_deferred(deferred) && parse_regular(snapshot, input_iterator, &token);
     }
 
-    static results_data_ptr_type prepare_results_data(
-        const parser_data_ptr_type& root_parser_data_ptr, const string_type& app_name)
+    bool parse_deferred(const deferred_subparser* deferred)
     {
-        auto results_data_ptr
-            = std::make_shared<results_data_type>(root_parser_data_ptr->m_dictionary->is_case_sensitive());
+        if (!deferred)
+        {
+            return true;
+        }
 
-        results_data_ptr->set_app_name(app_name);
-        fill_results_data_names(results_data_ptr, root_parser_data_ptr, string_type());
+        auto& snapshot = deferred->m_snapshot;
+        auto& argument = *snapshot.get_subparsers_argument();
 
-        return results_data_ptr;
+        return parse_deferred(deferred->m_parent) && parse_default_values(snapshot) && check_values_count(snapshot)
+            && parse_argument_value(
+                snapshot, argument, argument.get_first_name(), deferred->m_value, deferred->m_value_index);
     }
 
-    bool parse_exclusive_recursively(
-        const parser_data_ptr_type& parser_data_ptr, argument_table_iterator& input_iterator) const
+    bool parse_regular(
+        const snapshot_type& snapshot, argument_table_iterator& input_iterator, const named_token* first_token)
     {
-        if (input_iterator.get_remaining_count() == 0)
+        if (!parse_named_arguments(snapshot, input_iterator, first_token))
         {
-            // no arguments - exit
             return false;
         }
-        else if (input_iterator.get_remaining_count() == 1)
-        {
-            auto& arg_name = input_iterator.take_next();
 
-            auto arg_iter = parser_data_ptr->m_argument_repository->m_names_repository.find(arg_name);
-            if (arg_iter == parser_data_ptr->m_argument_repository->m_names_repository.end())
+        if (snapshot.get_subparsers_argument())
+        {
+            /* all remaining arguments will go to subparser so process this parser defaults & requirements */
+            return parse_default_values(snapshot) && check_values_count(snapshot)
+                && parse_subparsers_argument(snapshot, input_iterator);
+        }
+        else
+        {
+            if (!parse_positional_arguments(snapshot, input_iterator))
             {
-                // not an argument name
                 return false;
             }
 
-            auto& arg_object_ptr = arg_iter->second;
-
-            if (!arg_object_ptr->is_exclusive())
+            if (input_iterator.has_more())
             {
-                // not exclusive
-                return false;
+                return set_error(parser_error_code::SYNTAX_ERROR, input_iterator.get_index(), string_view_type(),
+                    input_iterator.peek_next_view());
             }
 
-            auto& value_str = parser_data_ptr->m_dictionary->get_switch_enabled_literal();
-
-            parse_argument_value(parser_data_ptr, arg_object_ptr, arg_name, value_str);
-
-            return true;
+            return parse_default_values(snapshot) && check_values_count(snapshot);
         }
-        else
+    }
+
+    bool parse_argument_value(const snapshot_type& snapshot, const argument_type& argument,
+        string_view_type arg_name, string_view_type value_str, std::size_t arg_index)
+    {
+        if (m_sink.value_count(argument) >= argument.get_max_count())
         {
-            if (!parser_data_ptr->m_argument_repository->m_subparsers_argument)
-            {
-                // no subparsers
-                return false;
-            }
+            return set_error(parser_error_code::TOO_MANY_OCCURRENCES, arg_index, arg_name, value_str);
+        }
 
-            auto& arg_name = input_iterator.take_next();
+        if (!check_allowed_value(snapshot, argument, arg_name, value_str, arg_index))
+        {
+            return false;
+        }
 
-            auto arg_iter = parser_data_ptr->m_argument_repository->m_names_repository.find(arg_name);
-            if (arg_iter != parser_data_ptr->m_argument_repository->m_names_repository.end())
-            {
-                // argument name, subparser expected
-                return false;
-            }
+        // if there is a handler call it first, to make sure the value
+        // is only stored if handler accepted it.
+        typed_value converted_value;
 
-            if (!parser_data_ptr->has_subparser(arg_name))
+        auto& handler = argument.get_handler();
+        if (handler)
+        {
+            if (!handle_value(snapshot, argument, *handler, arg_name, value_str, arg_index, converted_value))
             {
-                // not a subparser name
                 return false;
             }
-
-            return parse_exclusive_recursively(parser_data_ptr->get_subparser(arg_name), input_iterator);
         }
+
+        m_sink.append_value(argument, value_str, std::move(converted_value), arg_index);
+        return true;
     }
 
-    void parse_regular(const parser_data_ptr_type& parser_data_ptr, argument_table_iterator& input_iterator) const
+    /// Takes all remaining values the argument accepts at once. Values are
+    /// validated in one pass and passed to the sink as a range of arguments
+    /// table (values converted by handler are not kept).
+    bool parse_argument_values_range(
+        const snapshot_type& snapshot, const argument_type& argument, argument_table_iterator& input_iterator)
     {
-        parse_named_arguments(parser_data_ptr, input_iterator);
-        if (parser_data_ptr->m_argument_repository->m_subparsers_argument)
+        auto first_index = input_iterator.get_index();
+        auto count = std::min(
+            input_iterator.get_remaining_count(), argument.get_max_count() - m_sink.value_count(argument));
+        if (count == 0)
         {
-            /* all remaining arguments will go to subparser so process this parser defaults & requirements */
-            parse_default_values(parser_data_ptr);
-            check_values_count(parser_data_ptr);
-
-            parse_subparsers_argument(parser_data_ptr, input_iterator);
+            return true;
         }
-        else
+
+        auto& handler = argument.get_handler();
+        if (handler || !argument.get_allowed_values().empty())
         {
-            parse_positional_arguments(parser_data_ptr, input_iterator);
+            auto& arg_name = argument.get_first_name();
 
-            if (input_iterator.has_more())
+            typed_value converted_value;
+            for (auto index = first_index; index < first_index + count; ++index)
             {
-                throw parser_error_ex<char_type>(
-                    parser_error_code::SYNTAX_ERROR, string_type(), input_iterator.peek_next());
+                auto value_str = m_arg_table.get_argument_view(index);
+
+                if (!check_allowed_value(snapshot, argument, arg_name, value_str, index))
+                {
+                    return false;
+                }
+                if (handler)
+                {
+                    if (!handle_value(snapshot, argument, *handler, arg_name, value_str, index, converted_value))
+                    {
+                        return false;
+                    }
+                    converted_value.reset();
+                }
             }
-
-            parse_default_values(parser_data_ptr);
-            check_values_count(parser_data_ptr);
         }
+
+        input_iterator.skip(count);
+
+        m_sink.append_range(argument, m_arg_table, first_index, count);
+        return true;
     }
 
-    void parse_argument_value(const parser_data_ptr_type& parser_data_ptr, const const_argument_ptr_type& argument,
-        const string_type& arg_name, const string_type& value_str) const
+    bool check_allowed_value(const snapshot_type& snapshot, const argument_type& argument, string_view_type arg_name,
+        string_view_type value_str, std::size_t arg_index)
     {
-        if (m_results_data_ptr->value_count(argument) >= argument->get_max_count())
+        if (!snapshot.is_allowed_value(argument, value_str))
         {
-            throw parser_error_ex<char_type>(parser_error_code::TOO_MANY_OCCURRENCES, arg_name, value_str);
+            return set_error(parser_error_code::VALUE_NOT_ALLOWED, arg_index, arg_name, value_str);
         }
+        return true;
+    }
 
-        // check if the value is among the allowed
-        auto& allowed_values = argument->get_allowed_values();
-        if (!allowed_values.empty())
+    bool handle_value(const snapshot_type& snapshot, const argument_type& argument, const handler_type& handler,
+        string_view_type arg_name, string_view_type value_str, std::size_t arg_index, typed_value& converted_value)
+    {
+        try
         {
-            auto comparator = std::bind(string_equal<char_type>(parser_data_ptr->m_dictionary->is_case_sensitive()),
-                value_str, std::placeholders::_1);
-
-            if (std::find_if(allowed_values.begin(), allowed_values.end(), comparator) == allowed_values.end())
+            if (m_instrumentation.is_active())
             {
-                throw parser_error_ex<char_type>(parser_error_code::VALUE_NOT_ALLOWED, arg_name, value_str);
+                if (handle_value_timed(snapshot, argument, handler, value_str, converted_value))
+                {
+                    return true;
+                }
             }
+            else if (m_storage_helper.parse_with_handler(
+                         handler, snapshot.get_dictionary(), value_str, converted_value))
+            {
+                return true;
+            }
+        }
+        catch (const conversion_error&)
+        {
+            set_error(parser_error_code::CONVERSION_FAILED, arg_index, arg_name, value_str);
+            m_error.m_nested_exception = std::current_exception();
+            return false;
         }
 
-        // if there is a handler call it first, to make sure the value
-        // is only stored if handler accepted it.
-        auto handler = argument->get_handler();
-        if (handler)
+        return set_error(parser_error_code::CONVERSION_FAILED, arg_index, arg_name, value_str);
+    }
+
+    /// Calls converter and handler (check and store functions) separately,
+    /// so their durations are reported separately.
+    bool handle_value_timed(const snapshot_type& snapshot, const argument_type& argument, const handler_type& handler,
+        string_view_type value_str, typed_value& converted_value)
+    {
         {
-            try
-            {
-                m_storage_helper.parse_with_handler(*handler, *parser_data_ptr->m_dictionary, value_str);
-            }
-            catch (const conversion_error&)
+            converter_scope_type converter_scope(m_instrumentation, argument);
+            if (!m_storage_helper.convert_with_handler(handler, snapshot.get_dictionary(), value_str, converted_value))
             {
-                std::throw_with_nested(
-                    parser_error_ex<char_type>(parser_error_code::CONVERSION_FAILED, arg_name, value_str));
+                return false;
             }
         }
 
-        m_results_data_ptr->append_value(argument, value_str);
+        handler_scope_type handler_scope(m_instrumentation, argument);
+        m_storage_helper.check_and_store_with_handler(handler, converted_value);
+        return true;
     }
 
-    void parse_default_value(const parser_data_ptr_type& parser_data_ptr, const const_argument_ptr_type& argument) const
+    void parse_default_value(const default_values_entry_type& entry)
     {
-        if (m_results_data_ptr->value_count(argument) > 0)
+        auto& argument = *entry.m_argument;
+        if (m_sink.value_count(argument) > 0)
         {
             return;
         }
 
-        auto& values = argument->get_default_values();
-        if (values.empty())
+        // values were validated and converted when the snapshot was built
+        auto& default_values = entry.m_values;
+        for (std::size_t i = 0; i < default_values.size(); ++i)
         {
-            return;
+            typed_value converted_value;
+            if (entry.m_handler)
+            {
+                converted_value = entry.m_converted_values[i];
+
+                handler_scope_type handler_scope(m_instrumentation, argument);
+                m_storage_helper.store_with_handler(*entry.m_handler, converted_value);
+            }
+
+            m_sink.append_value(argument, default_values[i], std::move(converted_value), DEFAULT_VALUE_INDEX);
         }
+    }
 
-        for (auto& value : values)
+    /// Always succeeds (returns bool to be chained with other parsing steps).
+    bool parse_default_values(const snapshot_type& snapshot)
+    {
+        phase_scope_type phase_scope(m_instrumentation, parse_phase::DEFAULT_VALUES);
+
+        for (auto& entry : snapshot.get_default_values())
         {
-            // TODO: should we throw logic_error instead of runtime_error if value is invalid?
-            parse_argument_value(parser_data_ptr, argument, argument->get_first_name(), value);
+            parse_default_value(entry);
         }
+        return true;
     }
 
-    void parse_default_values(const parser_data_ptr_type& parser_data_ptr) const
+    named_token resolve_named_token(const snapshot_type& snapshot, string_view_type input_value) const
     {
-        for (auto& argument : parser_data_ptr->m_argument_repository->m_arguments)
+        named_token token;
+
+        if (!snapshot.may_be_argument_name(input_value))
+        {
+            // not an argument name (i.e. positional value)
+            token.m_name = input_value;
+            token.m_has_value = false;
+            token.m_argument = nullptr;
+            return token;
+        }
+
+        auto value_separator = snapshot.get_value_separator_literal();
+
+        auto value_separator_pos = input_value.find(value_separator);
+        if (value_separator_pos == string_view_type::npos)
+        {
+            token.m_name = input_value;
+            token.m_has_value = false;
+        }
+        else
         {
-            parse_default_value(parser_data_ptr, argument);
+            token.m_name = input_value.substr(0, value_separator_pos);
+            token.m_value = input_value.substr(value_separator_pos + value_separator.size());
+            token.m_has_value = true;
         }
+
+        token.m_argument = snapshot.find_argument(token.m_name);
+        m_instrumentation.name_lookup(token.m_name, token.m_argument != nullptr);
+        return token;
     }
 
-    bool parse_named_argument(const parser_data_ptr_type& parser_data_ptr, argument_table_iterator& input_iterator,
-        const string_type& arg_name) const
+    bool parse_named_argument(const snapshot_type& snapshot, argument_table_iterator& input_iterator,
+        const named_token& token, bool& is_named)
     {
-        auto arg_iter = parser_data_ptr->m_argument_repository->m_names_repository.find(arg_name);
-        if (arg_iter == parser_data_ptr->m_argument_repository->m_names_repository.end())
+        auto arg_object_ptr = token.m_argument;
+        if (!arg_object_ptr)
         {
             // not an argument name, goto positional arguments processing
-            return false;
+            return true;
         }
 
-        auto& arg_object_ptr = arg_iter->second;
-
         if (!arg_object_ptr->is_assignable_by_name() || arg_object_ptr->is_exclusive())
         {
             // not an named argument, goto positional arguments processing
-            return false;
+            return true;
         }
 
+        is_named = true;
+
         // argument found, so remove element from input
-        input_iterator.take_next();
+        auto arg_index = input_iterator.get_index();
+        input_iterator.take_next_view();
 
-        string_type value_str;
+        if (token.m_has_value)
+        {
+            if (!arg_object_ptr->is_accepting_immediate_value())
+            {
+                return set_error(parser_error_code::UNEXPECTED_VALUE, arg_index, token.m_name, token.m_value);
+            }
 
-        if (arg_object_ptr->is_accepting_separate_value())
+            return parse_argument_value(snapshot, *arg_object_ptr, token.m_name, token.m_value, arg_index);
+        }
+        else if (arg_object_ptr->is_accepting_separate_value())
         {
             if (!input_iterator.has_more())
             {
-                throw parser_error_ex<char_type>(parser_error_code::VALUE_MISSING, arg_name, string_type());
+                return set_error(parser_error_code::VALUE_MISSING, arg_index, token.m_name, string_view_type());
             }
 
-            value_str = input_iterator.take_next();
+            auto value_index = input_iterator.get_index();
+            return parse_argument_value(
+                snapshot, *arg_object_ptr, token.m_name, input_iterator.take_next_view(), value_index);
         }
         else
         {
-            value_str = parser_data_ptr->m_dictionary->get_switch_enabled_literal();
+            auto value_str = snapshot.get_switch_enabled_literal();
+
+            return parse_argument_value(snapshot, *arg_object_ptr, token.m_name, value_str, arg_index);
         }
+    }
+
+    /// First token (if not null) is the already resolved next input argument.
+    bool parse_named_arguments(
+        const snapshot_type& snapshot, argument_table_iterator& input_iterator, const named_token* first_token)
+    {
+        phase_scope_type phase_scope(m_instrumentation, parse_phase::NAMED_ARGUMENTS);
 
-        parse_argument_value(parser_data_ptr, arg_object_ptr, arg_name, value_str);
+        while (input_iterator.has_more())
+        {
+            auto token = first_token ? *first_token : resolve_named_token(snapshot, input_iterator.peek_next_view());
+            first_token = nullptr;
 
+            bool is_named = false;
+            if (!parse_named_argument(snapshot, input_iterator, token, is_named))
+            {
+                return false;
+            }
+            if (!is_named)
+            {
+                break;
+            }
+        }
         return true;
     }
 
-    bool parse_named_argument(const parser_data_ptr_type& parser_data_ptr, argument_table_iterator& input_iterator,
-        const string_type& arg_name, const string_type& arg_value) const
+    bool parse_subparsers_argument(const snapshot_type& snapshot, argument_table_iterator& input_iterator)
     {
-        auto arg_iter = parser_data_ptr->m_argument_repository->m_names_repository.find(arg_name);
-        if (arg_iter == parser_data_ptr->m_argument_repository->m_names_repository.end())
+        auto& argument = *snapshot.get_subparsers_argument();
+        auto& name = argument.get_first_name();
+
+        if (!input_iterator.has_more())
         {
-            return false;
+            return set_error(parser_error_code::SUBPARSER_NAME_MISSING, NO_INDEX, name, string_view_type());
         }
 
-        auto& arg_object_ptr = arg_iter->second;
+        auto value_index = input_iterator.get_index();
+        auto value_str = input_iterator.take_next_view();
 
-        if (!arg_object_ptr->is_assignable_by_name() || arg_object_ptr->is_exclusive())
+        auto subparser_ptr = snapshot.find_subparser(value_str);
+        m_instrumentation.name_lookup(value_str, subparser_ptr != nullptr);
+        if (!subparser_ptr)
         {
-            // not an named argument, goto positional arguments processing
-            return false;
+            return set_error(parser_error_code::SUBPARSER_NOT_FOUND, value_index, name, string_view_type());
         }
 
-        // argument found, so remove element from input
-        input_iterator.take_next();
+        return parse_argument_value(snapshot, argument, name, value_str, value_index)
+            && parse_regular(*subparser_ptr, input_iterator, nullptr);
+    }
 
-        if (!arg_object_ptr->is_accepting_immediate_value())
+    bool parse_positional_arguments(const snapshot_type& snapshot, argument_table_iterator& input_iterator)
+    {
+        phase_scope_type phase_scope(m_instrumentation, parse_phase::POSITIONAL_ARGUMENTS);
+
+        for (auto argument : snapshot.get_positional_arguments())
         {
-            throw parser_error_ex<char_type>(parser_error_code::UNEXPECTED_VALUE, arg_name, arg_value);
+            if (argument->is_storing_values_as_range())
+            {
+                if (!parse_argument_values_range(snapshot, *argument, input_iterator))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            while ((m_sink.value_count(*argument) < argument->get_max_count()) && input_iterator.has_more())
+            {
+                auto value_index = input_iterator.get_index();
+                auto value_str = input_iterator.take_next_view();
+
+                if (!parse_argument_value(snapshot, *argument, argument->get_first_name(), value_str, value_index))
+                {
+                    return false;
+                }
+            }
         }
+        return true;
+    }
 
-        parse_argument_value(parser_data_ptr, arg_object_ptr, arg_name, arg_value);
+    bool check_values_count(const snapshot_type& snapshot)
+    {
+        phase_scope_type phase_scope(m_instrumentation, parse_phase::VALUES_COUNT_CHECK);
+
+        for (auto argument : snapshot.get_required_arguments())
+        {
+            if (m_sink.value_count(*argument) < argument->get_min_count())
+            {
+                return set_error(parser_error_code::REQUIRED_ARGUMENT_MISSING, NO_INDEX, argument->get_first_name(),
+                    string_view_type());
+            }
+        }
         return true;
     }
 
-    bool parse_named_argument(
-        const parser_data_ptr_type& parser_data_ptr, argument_table_iterator& input_iterator) const
+    /// Stores the error description, always returns false.
+    bool set_error(
+        parser_error_code error_code, std::size_t index, string_view_type arg_name, string_view_type value_str)
     {
-        auto& input_value = input_iterator.peek_next();
+        m_error.m_code = error_code;
+        m_error.m_index = index;
+        m_error.m_name = arg_name;
+        m_error.m_value = value_str;
+        return false;
+    }
+
+    const argument_table_type& m_arg_table;
+    storage_helper_type& m_storage_helper;
+    const snapshot_type& m_root_snapshot;
+    sink_type& m_sink;
+    error_info_type m_error;
+    instrumentation_type m_instrumentation;
+};
 
-        auto& value_separator = parser_data_ptr->m_dictionary->get_value_separator_literal();
+/// \brief Sink storing values in results data
+template <typename char_T>
+class basic_results_sink
+{
+public:
+    using char_type = char_T;
 
-        auto value_separator_pos = input_value.find(value_separator);
-        if (value_separator_pos == string_type::npos)
+    using string_view_type = basic_string_view<char_type>;
+
+    using argument_tag_type = basic_argument_tag;
+
+    using results_data_type = basic_results_data<char_type>;
+
+    explicit basic_results_sink(results_data_type& results_data)
+        : m_results_data(results_data)
+    {
+        // noop
+    }
+
+    std::size_t value_count(const argument_tag_type& argument) const
+    {
+        return m_results_data.value_count(argument);
+    }
+
+    void append_value(const argument_tag_type& argument, string_view_type value, typed_value&& converted_value,
+        std::size_t /*arg_index*/)
+    {
+        if (converted_value.empty())
         {
-            return parse_named_argument(parser_data_ptr, input_iterator, input_value);
+            m_results_data.append_value(argument, value);
         }
         else
         {
-            auto name_str = input_value.substr(0, value_separator_pos);
-            auto value_str = input_value.substr(value_separator_pos + value_separator.size());
-
-            return parse_named_argument(parser_data_ptr, input_iterator, name_str, value_str);
+            m_results_data.append_value(argument, value, std::move(converted_value));
         }
     }
 
-    void parse_named_arguments(
-        const parser_data_ptr_type& parser_data_ptr, argument_table_iterator& input_iterator) const
+    void append_range(const argument_tag_type& argument, const basic_argument_table<char_type>& arg_table,
+        std::size_t first_index, std::size_t count)
     {
-        while (input_iterator.has_more())
+        m_results_data.set_value_range(argument, arg_table.get_argument_views(), first_index, count);
+    }
+
+private:
+    results_data_type& m_results_data;
+};
+
+/// \brief Sink passing values to parse visitor (only values count is stored)
+template <typename char_T>
+class basic_visitor_sink
+{
+public:
+    using char_type = char_T;
+
+    using string_type = std::basic_string<char_type>;
+    using string_vector_type = std::vector<string_type>;
+    using string_view_type = basic_string_view<char_type>;
+
+    using argument_tag_type = basic_argument_tag;
+
+    using visitor_type = basic_parse_visitor<char_type>;
+    using argument_handle_type = typename visitor_type::argument_handle_type;
+
+    basic_visitor_sink(visitor_type& visitor, std::size_t slot_count, const string_vector_type& qualified_names)
+        : m_visitor(visitor)
+        , m_value_counts(slot_count, 0)
+        , m_qualified_names(qualified_names)
+    {
+        // noop
+    }
+
+    std::size_t value_count(const argument_tag_type& argument) const
+    {
+        return m_value_counts[argument.get_slot()];
+    }
+
+    template <typename argument_T>
+    void append_value(
+        const argument_T& argument, string_view_type value, typed_value&& /*converted_value*/, std::size_t arg_index)
+    {
+        ++m_value_counts[argument.get_slot()];
+
+        // engine uses the same index value for defaults as the visitor interface
+        m_visitor.on_value(get_argument_handle(argument), value, arg_index);
+    }
+
+    template <typename argument_T>
+    void append_range(const argument_T& argument, const basic_argument_table<char_type>& arg_table,
+        std::size_t first_index, std::size_t count)
+    {
+        m_value_counts[argument.get_slot()] += count;
+
+        auto argument_handle = get_argument_handle(argument);
+        for (std::size_t i = 0; i < count; ++i)
         {
-            if (!parse_named_argument(parser_data_ptr, input_iterator))
-            {
-                break;
-            }
+            m_visitor.on_value(argument_handle, arg_table.get_argument_view(first_index + i), first_index + i);
         }
     }
 
-    void parse_subparsers_argument(
-        const parser_data_ptr_type& parser_data_ptr, argument_table_iterator& input_iterator) const
+private:
+    template <typename argument_T>
+    argument_handle_type get_argument_handle(const argument_T& argument) const
     {
-        auto& name = parser_data_ptr->m_argument_repository->m_subparsers_argument->get_first_name();
+        return argument_handle_type(argument, m_qualified_names[argument.get_slot()]);
+    }
 
-        if (!input_iterator.has_more())
+    visitor_type& m_visitor;
+    std::vector<std::size_t> m_value_counts;
+    const string_vector_type& m_qualified_names;
+};
+
+/// \brief Sink counting values only (used for validation)
+///
+/// Counters are kept in a per thread buffer sized by the snapshot slot count
+/// and reused by subsequent validations, so memory is allocated only when the
+/// thread validates with a bigger parsers tree for the first time. Nested
+/// validation (e.g. called by a converter) uses its own buffer.
+template <typename char_T>
+class basic_counting_sink
+{
+public:
+    using char_type = char_T;
+
+    using string_view_type = basic_string_view<char_type>;
+
+    using argument_tag_type = basic_argument_tag;
+
+    explicit basic_counting_sink(std::size_t slot_count)
+        : m_thread_buffer(acquire_thread_buffer())
+        , m_local_counts()
+        , m_value_counts(nullptr)
+    {
+        auto& counts = m_thread_buffer ? m_thread_buffer->m_counts : m_local_counts;
+        counts.assign(slot_count, 0);
+        m_value_counts = counts.data();
+    }
+
+    ~basic_counting_sink()
+    {
+        if (m_thread_buffer)
         {
-            throw parser_error_ex<char_type>(parser_error_code::SUBPARSER_NAME_MISSING, name, string_type());
+            m_thread_buffer->m_in_use = false;
         }
+    }
+
+    basic_counting_sink(const basic_counting_sink&) = delete;
+    basic_counting_sink& operator=(const basic_counting_sink&) = delete;
+
+    std::size_t value_count(const argument_tag_type& argument) const
+    {
+        return m_value_counts[argument.get_slot()];
+    }
 
-        auto& argument = parser_data_ptr->m_argument_repository->m_subparsers_argument;
-        auto& value_str = input_iterator.take_next();
+    void append_value(const argument_tag_type& argument, string_view_type /*value*/,
+        typed_value&& /*converted_value*/, std::size_t /*arg_index*/)
+    {
+        ++m_value_counts[argument.get_slot()];
+    }
+
+    void append_range(const argument_tag_type& argument, const basic_argument_table<char_type>& /*arg_table*/,
+        std::size_t /*first_index*/, std::size_t count)
+    {
+        m_value_counts[argument.get_slot()] += count;
+    }
 
-        if (!parser_data_ptr->has_subparser(value_str))
+private:
+    struct thread_buffer
+    {
+        std::vector<std::size_t> m_counts;
+        bool m_in_use;
+    };
+
+    /// Returns the thread buffer or null if it is used by the outer validation.
+    static thread_buffer* acquire_thread_buffer()
+    {
+        static thread_local thread_buffer buffer { std::vector<std::size_t>(), false };
+
+        if (buffer.m_in_use)
         {
-            throw parser_error_ex<char_type>(parser_error_code::SUBPARSER_NOT_FOUND, name, string_type());
+            return nullptr;
         }
+        buffer.m_in_use = true;
+        return &buffer;
+    }
 
-        parse_argument_value(parser_data_ptr, argument, argument->get_first_name(), value_str);
+    thread_buffer* m_thread_buffer;
+    std::vector<std::size_t> m_local_counts;
+    std::size_t* m_value_counts;
+};
 
-        parse_regular(parser_data_ptr->get_subparser(value_str), input_iterator);
+/// \brief Parser engine producing results
+template <typename char_T, typename values_storage_T>
+class basic_parser_engine
+{
+public:
+    using char_type = char_T;
+    using values_storage_type = values_storage_T;
+
+    using argument_table_type = basic_argument_table<char_type>;
+    using results_type = basic_results<char_type>;
+    using parse_result_type = basic_parse_result<char_type>;
+
+    using storage_helper_type = storage_handler_helper<char_type, values_storage_type>;
+
+    using snapshot_type = basic_parser_snapshot<char_type, values_storage_type>;
+    using const_snapshot_ptr_type = std::shared_ptr<const snapshot_type>;
+
+    using results_data_type = basic_results_data<char_type>;
+    using results_data_ptr_type = std::shared_ptr<results_data_type>;
+
+    /// Results data must be created for the given snapshot and must be empty.
+    basic_parser_engine(const argument_table_type& arg_table, storage_helper_type& storage_helper,
+        const const_snapshot_ptr_type& root_snapshot_ptr, const results_data_ptr_type& results_data_ptr)
+        : m_arg_table(arg_table)
+        , m_storage_helper(storage_helper)
+        , m_root_snapshot_ptr(root_snapshot_ptr)
+        , m_results_data_ptr(results_data_ptr)
+    {
+        m_results_data_ptr->set_app_name(m_arg_table.get_app_name());
+
+        // results store views so keep the strings owners alive
+        m_results_data_ptr->add_keep_alive(m_arg_table.get_storage());
+        for (auto& response_file_ptr : m_arg_table.get_response_files())
+        {
+            m_results_data_ptr->add_keep_alive(response_file_ptr);
+        }
+        m_results_data_ptr->add_keep_alive(root_snapshot_ptr);
     }
 
-    void parse_positional_arguments(
-        const parser_data_ptr_type& parser_data_ptr, argument_table_iterator& input_iterator) const
+    results_type parse()
     {
-        for (auto& argument : parser_data_ptr->m_argument_repository->m_arguments)
+        sink_type sink(*m_results_data_ptr);
+
+        core_type core(m_arg_table, m_storage_helper, *m_root_snapshot_ptr, sink);
+        if (!core.parse())
         {
-            if (argument->is_assignable_by_name())
-            {
-                continue;
-            }
+            core.get_error().throw_exception();
+        }
 
-            while ((m_results_data_ptr->value_count(argument) < argument->get_max_count()) && input_iterator.has_more())
-            {
-                const auto& value_str = input_iterator.take_next();
+        return results_type(get_dictionary_ptr(), m_results_data_ptr);
+    }
 
-                parse_argument_value(parser_data_ptr, argument, argument->get_first_name(), value_str);
-            }
+    /// \brief Parses without throwing parsing errors
+    parse_result_type try_parse()
+    {
+        sink_type sink(*m_results_data_ptr);
+
+        core_type core(m_arg_table, m_storage_helper, *m_root_snapshot_ptr, sink);
+        if (!core.parse())
+        {
+            auto& error = core.get_error();
+            return parse_result_type(error.m_code, error.m_index, error.m_name, error.m_value, m_root_snapshot_ptr);
         }
+
+        return parse_result_type(results_type(get_dictionary_ptr(), m_results_data_ptr));
     }
 
-    void check_values_count(const parser_data_ptr_type& parser_data_ptr) const
+private:
+    using sink_type = basic_results_sink<char_type>;
+    using core_type = basic_parser_engine_core<char_type, values_storage_type, sink_type>;
+
+    using const_dictionary_ptr_type = typename snapshot_type::const_dictionary_ptr_type;
+
+    /// Dictionary pointer sharing ownership with the snapshot pointer (the
+    /// snapshot keeps the dictionary alive), so only the snapshot pointer
+    /// reference count is updated.
+    const_dictionary_ptr_type get_dictionary_ptr() const
     {
-        for (auto& argument : parser_data_ptr->m_argument_repository->m_arguments)
+        return const_dictionary_ptr_type(m_root_snapshot_ptr, &m_root_snapshot_ptr->get_dictionary());
+    }
+
+    const argument_table_type& m_arg_table;
+    storage_helper_type& m_storage_helper;
+    const const_snapshot_ptr_type& m_root_snapshot_ptr;
+    results_data_ptr_type m_results_data_ptr;
+};
+
+/// \brief Parser engine passing values to parse visitor
+template <typename char_T, typename values_storage_T>
+class basic_visiting_parser_engine
+{
+public:
+    using char_type = char_T;
+    using values_storage_type = values_storage_T;
+
+    using argument_table_type = basic_argument_table<char_type>;
+
+    using storage_helper_type = storage_handler_helper<char_type, values_storage_type>;
+
+    using snapshot_type = basic_parser_snapshot<char_type, values_storage_type>;
+
+    using visitor_type = basic_parse_visitor<char_type>;
+
+    basic_visiting_parser_engine(const argument_table_type& arg_table, storage_helper_type& storage_helper,
+        const snapshot_type& root_snapshot, visitor_type& visitor)
+        : m_arg_table(arg_table)
+        , m_storage_helper(storage_helper)
+        , m_root_snapshot(root_snapshot)
+        , m_visitor(visitor)
+    {
+        // noop
+    }
+
+    void parse()
+    {
+        sink_type sink(m_visitor, m_root_snapshot.get_slot_count(), m_root_snapshot.get_qualified_names());
+
+        core_type core(m_arg_table, m_storage_helper, m_root_snapshot, sink);
+        if (!core.parse())
         {
-            if (m_results_data_ptr->value_count(argument) < argument->get_min_count())
-            {
-                throw parser_error_ex<char_type>(
-                    parser_error_code::REQUIRED_ARGUMENT_MISSING, argument->get_first_name(), string_type());
-            }
+            core.get_error().throw_exception();
         }
     }
 
+private:
+    using sink_type = basic_visitor_sink<char_type>;
+    using core_type = basic_parser_engine_core<char_type, values_storage_type, sink_type>;
+
     const argument_table_type& m_arg_table;
     storage_helper_type& m_storage_helper;
-    const parser_data_ptr_type& m_root_parser_data_ptr;
+    const snapshot_type& m_root_snapshot;
+    visitor_type& m_visitor;
+};
 
-    results_data_ptr_type m_results_data_ptr;
+/// \brief Parser engine validating arguments only
+///
+/// All the parsing rules are applied and values are converted and checked,
+/// but values are only counted (no results are created) and storage
+/// handlers are not called.
+template <typename char_T, typename values_storage_T>
+class basic_validating_parser_engine
+{
+public:
+    using char_type = char_T;
+    using values_storage_type = values_storage_T;
+
+    using argument_table_type = basic_argument_table<char_type>;
+    using validation_result_type = basic_validation_result<char_type>;
+
+    using snapshot_type = basic_parser_snapshot<char_type, values_storage_type>;
+    using const_snapshot_ptr_type = std::shared_ptr<const snapshot_type>;
+
+    basic_validating_parser_engine(
+        const argument_table_type& arg_table, const const_snapshot_ptr_type& root_snapshot_ptr)
+        : m_arg_table(arg_table)
+        , m_root_snapshot_ptr(root_snapshot_ptr)
+    {
+        // noop
+    }
+
+    validation_result_type validate()
+    {
+        sink_type sink(m_root_snapshot_ptr->get_slot_count());
+        storage_helper_type storage_helper;
+
+        core_type core(m_arg_table, storage_helper, *m_root_snapshot_ptr, sink);
+        if (!core.parse())
+        {
+            auto& error = core.get_error();
+            return validation_result_type(
+                error.m_code, error.m_index, error.m_name, error.m_value, m_root_snapshot_ptr);
+        }
+
+        return validation_result_type();
+    }
+
+private:
+    using sink_type = basic_counting_sink<char_type>;
+    using storage_helper_type = validation_handler_helper<char_type, values_storage_type>;
+    using core_type = basic_parser_engine_core<char_type, values_storage_type, sink_type, storage_helper_type>;
+
+    const argument_table_type& m_arg_table;
+    const const_snapshot_ptr_type& m_root_snapshot_ptr;
 };
 
 } // namespace internal
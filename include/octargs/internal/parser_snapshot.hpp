@@ -0,0 +1,430 @@
+#ifndef OCTARGS_PARSER_SNAPSHOT_HPP_
+#define OCTARGS_PARSER_SNAPSHOT_HPP_
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../dictionary.hpp"
+#include "../exception.hpp"
+#include "../string_view.hpp"
+#include "argument.hpp"
+#include "first_char_filter.hpp"
+#include "name_index.hpp"
+#include "parser_data.hpp"
+#include "results_data.hpp"
+#include "typed_value.hpp"
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+/// \brief Immutable snapshot of the parser definition
+///
+/// Snapshot is built for the parser and (recursively) for all its subparsers
+/// and contains data prepared for fast parsing (i.e. hashed names indexes).
+/// The snapshot shares ownership of the arguments and the dictionary so it
+/// stays valid even if arguments or subparsers are added to the parser later.
+///
+/// \tparam char_T              char type (as in std::basic_string)
+/// \tparam values_storage_T    type of class uses as a storage for parsed values
+template <typename char_T, typename values_storage_T>
+class basic_parser_snapshot
+{
+public:
+    using char_type = char_T;
+    using values_storage_type = values_storage_T;
+
+    using string_type = std::basic_string<char_type>;
+    using string_vector_type = std::vector<string_type>;
+    using string_view_type = basic_string_view<char_type>;
+
+    using dictionary_type = dictionary<char_type>;
+    using const_dictionary_ptr_type = std::shared_ptr<const dictionary_type>;
+
+    using argument_type = basic_argument<char_type, values_storage_type>;
+    using const_argument_ptr_type = std::shared_ptr<const argument_type>;
+    using argument_vector_type = std::vector<const_argument_ptr_type>;
+    using argument_list_type = std::vector<const argument_type*>;
+    using const_handler_ptr_type = typename argument_type::const_handler_ptr_type;
+
+    /// \brief Default values of the argument validated and converted when the snapshot is built
+    struct default_values_entry
+    {
+        const argument_type* m_argument;
+        /// Default values (copied, values could be changed later in the argument; results reference them).
+        string_vector_type m_values;
+        /// Handler used for conversion (handler could be replaced later in the argument).
+        const_handler_ptr_type m_handler;
+        /// Values converted by the handler (in order of default values, empty if there is no handler).
+        std::vector<typed_value> m_converted_values;
+    };
+    using default_values_entry_vector_type = std::vector<default_values_entry>;
+
+    using name_entry_type = std::pair<string_type, const argument_type*>;
+    using name_entry_vector_type = std::vector<name_entry_type>;
+
+    using allowed_values_index_type = basic_name_index<char_type, std::size_t>;
+    /// Allowed values indexes of the parsers tree arguments (by slot, null if argument has no allowed values).
+    using allowed_values_table_type = std::vector<std::unique_ptr<const allowed_values_index_type>>;
+    using allowed_values_table_ptr_type = std::shared_ptr<allowed_values_table_type>;
+
+    using subparser_entry_type = std::pair<string_type, std::unique_ptr<const basic_parser_snapshot>>;
+    using subparser_entry_vector_type = std::vector<subparser_entry_type>;
+
+    using parser_data_type = basic_parser_data<char_type, values_storage_type>;
+    using parse_observer_type = typename parser_data_type::parse_observer_type;
+    using parse_observer_ptr_type = typename parser_data_type::parse_observer_ptr_type;
+
+    using results_data_type = basic_results_data<char_type>;
+    using results_data_ptr_type = std::shared_ptr<results_data_type>;
+    using results_names_index_type = typename results_data_type::names_index_type;
+    using const_results_names_index_ptr_type = typename results_data_type::const_names_index_ptr_type;
+
+    using const_snapshot_ptr_type = std::shared_ptr<const basic_parser_snapshot>;
+
+    explicit basic_parser_snapshot(const parser_data_type& parser_data)
+        : basic_parser_snapshot(parser_data, allowed_values_table_ptr_type())
+    {
+        // noop
+    }
+
+    basic_parser_snapshot(const basic_parser_snapshot&) = delete;
+    basic_parser_snapshot& operator=(const basic_parser_snapshot&) = delete;
+
+    /// \brief Returns snapshot of the given parser data
+    ///
+    /// The snapshot is cached in the parser data and rebuilt only if the
+    /// parsers tree or the dictionary was modified since the snapshot was
+    /// created. The cache is
+    /// accessed atomically so the function could be called concurrently as
+    /// long as the parsers tree is not modified at the same time.
+    static const_snapshot_ptr_type get(parser_data_type& parser_data)
+    {
+        auto snapshot_ptr = std::atomic_load(&parser_data.m_snapshot);
+        if (!snapshot_ptr || (snapshot_ptr->m_revision != parser_data.m_tree_state->get_revision())
+            || (snapshot_ptr->m_dictionary_revision != parser_data.m_dictionary->get_revision()))
+        {
+            snapshot_ptr = std::make_shared<basic_parser_snapshot>(parser_data);
+            std::atomic_store(&parser_data.m_snapshot, snapshot_ptr);
+        }
+        return snapshot_ptr;
+    }
+
+    /// \brief Creates (empty) results data for parsing with this snapshot
+    results_data_ptr_type create_results_data() const
+    {
+        return std::make_shared<results_data_type>(m_results_names_index, m_slot_count);
+    }
+
+    /// \brief Creates (empty) results data sharing ownership with the given owner
+    ///
+    /// The results data does not reference the snapshot members directly, so
+    /// threads using their own owners do not contend on the reference counts.
+    results_data_ptr_type create_results_data(const std::shared_ptr<const void>& owner_ptr) const
+    {
+        return std::make_shared<results_data_type>(
+            const_results_names_index_ptr_type(owner_ptr, m_results_names_index.get()), m_slot_count);
+    }
+
+    const const_dictionary_ptr_type& get_dictionary_ptr() const
+    {
+        return m_dictionary;
+    }
+
+    const dictionary_type& get_dictionary() const
+    {
+        return *m_dictionary;
+    }
+
+    /// \brief Returns dictionary value separator (cached, no virtual call per token)
+    string_view_type get_value_separator_literal() const
+    {
+        return m_value_separator_literal;
+    }
+
+    /// \brief Returns dictionary switch enabled literal (cached, no virtual call per token)
+    string_view_type get_switch_enabled_literal() const
+    {
+        return m_switch_enabled_literal;
+    }
+
+    /// \brief Returns arguments first names with subparser prefixes by slot (root snapshot only)
+    const string_vector_type& get_qualified_names() const
+    {
+        return m_qualified_names;
+    }
+
+    /// \brief Returns parse observer (null if not set)
+    parse_observer_type* get_parse_observer() const
+    {
+        return m_parse_observer.get();
+    }
+
+    std::size_t get_slot_count() const
+    {
+        return m_slot_count;
+    }
+
+    const argument_vector_type& get_arguments() const
+    {
+        return m_arguments;
+    }
+
+    /// \brief Returns positional arguments (in order of definition)
+    const argument_list_type& get_positional_arguments() const
+    {
+        return m_positional_arguments;
+    }
+
+    /// \brief Returns prepared default values of the arguments having them
+    const default_values_entry_vector_type& get_default_values() const
+    {
+        return m_default_values;
+    }
+
+    /// \brief Returns arguments requiring at least one value
+    const argument_list_type& get_required_arguments() const
+    {
+        return m_required_arguments;
+    }
+
+    const argument_type* get_subparsers_argument() const
+    {
+        return m_subparsers_argument.get();
+    }
+
+    /// \brief Returns false if the input value cannot start with any argument name
+    bool may_be_argument_name(string_view_type input_value) const
+    {
+        return m_names_first_chars.may_match(input_value);
+    }
+
+    /// \brief Returns true if there are no allowed values for the argument or the value is among them
+    ///
+    /// Allowed values are compared using the dictionary case sensitivity at the time the snapshot was built.
+    bool is_allowed_value(const argument_type& argument, string_view_type value) const
+    {
+        auto& index_ptr = (*m_allowed_values)[argument.get_slot()];
+        return !index_ptr || (index_ptr->find(value) != nullptr);
+    }
+
+    const argument_type* find_argument(string_view_type name) const
+    {
+        auto argument_ptr = m_names_index.find(name);
+        return argument_ptr ? *argument_ptr : nullptr;
+    }
+
+    const basic_parser_snapshot* find_subparser(string_view_type name) const
+    {
+        auto subparser_ptr = m_subparsers_index.find(name);
+        return subparser_ptr ? *subparser_ptr : nullptr;
+    }
+
+private:
+    /// Root snapshot is created with null allowed values table (the table is shared with the subparsers).
+    basic_parser_snapshot(const parser_data_type& parser_data, const allowed_values_table_ptr_type& allowed_values)
+        : m_revision(parser_data.m_tree_state->get_revision())
+        , m_dictionary(parser_data.m_dictionary)
+        , m_dictionary_revision(m_dictionary->get_revision())
+        , m_value_separator_literal(m_dictionary->get_value_separator_literal())
+        , m_switch_enabled_literal(m_dictionary->get_switch_enabled_literal())
+        , m_parse_observer(parser_data.m_parse_observer)
+        , m_slot_count(parser_data.m_tree_state->get_slot_count())
+        , m_allowed_values(allowed_values)
+        , m_arguments(parser_data.m_argument_repository->m_arguments)
+        , m_subparsers_argument(parser_data.m_argument_repository->m_subparsers_argument)
+        , m_positional_arguments()
+        , m_default_values()
+        , m_required_arguments()
+        , m_names()
+        , m_names_index(m_dictionary->is_case_sensitive())
+        , m_names_first_chars(m_dictionary->is_case_sensitive())
+        , m_subparsers()
+        , m_subparsers_index(m_dictionary->is_case_sensitive())
+        , m_results_names_index()
+        , m_qualified_names()
+    {
+        bool is_root = !m_allowed_values;
+        if (is_root)
+        {
+            m_allowed_values = std::make_shared<allowed_values_table_type>(m_slot_count);
+        }
+
+        for (auto& argument : m_arguments)
+        {
+            if (!argument->get_allowed_values().empty())
+            {
+                (*m_allowed_values)[argument->get_slot()] = create_allowed_values_index(*argument);
+            }
+            if (!argument->is_assignable_by_name())
+            {
+                m_positional_arguments.push_back(argument.get());
+            }
+            if (!argument->get_default_values().empty())
+            {
+                m_default_values.push_back(prepare_default_values(*argument));
+            }
+            if (argument->get_min_count() > 0)
+            {
+                m_required_arguments.push_back(argument.get());
+            }
+        }
+
+        for (auto& name_item : parser_data.m_argument_repository->m_names_repository)
+        {
+            m_names.emplace_back(name_item.first, name_item.second.get());
+            m_names_index.insert(name_item.first, name_item.second.get());
+            m_names_first_chars.insert(name_item.first);
+        }
+
+        for (auto& subparser_item : parser_data.get_subparsers())
+        {
+            std::unique_ptr<const basic_parser_snapshot> subparser(
+                new basic_parser_snapshot(*subparser_item.second, m_allowed_values));
+
+            m_subparsers_index.insert(subparser_item.first, subparser.get());
+            m_subparsers.emplace_back(subparser_item.first, std::move(subparser));
+        }
+
+        if (is_root)
+        {
+            auto names_index_ptr = std::make_shared<results_names_index_type>(m_dictionary->is_case_sensitive());
+            fill_results_names_index(*names_index_ptr, string_type());
+            m_results_names_index = names_index_ptr;
+
+            m_qualified_names.resize(m_slot_count);
+            fill_qualified_names(m_qualified_names, string_type());
+        }
+    }
+
+    std::unique_ptr<const allowed_values_index_type> create_allowed_values_index(const argument_type& argument) const
+    {
+        auto& values = argument.get_allowed_values();
+
+        allowed_values_index_type index(m_dictionary->is_case_sensitive());
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            index.insert(values[i], i);
+        }
+        return std::unique_ptr<const allowed_values_index_type>(new allowed_values_index_type(std::move(index)));
+    }
+
+    /// Validates and converts default values once, so parsing only copies them.
+    default_values_entry prepare_default_values(const argument_type& argument) const
+    {
+        using exception_type = invalid_default_value_ex<char_type>;
+
+        auto& name = argument.get_first_name();
+
+        default_values_entry entry {
+            &argument, argument.get_default_values(), argument.get_handler(), std::vector<typed_value>()
+        };
+
+        if (entry.m_values.size() > argument.get_max_count())
+        {
+            throw exception_type("Too many default values", name, entry.m_values[argument.get_max_count()]);
+        }
+
+        for (auto& value : entry.m_values)
+        {
+            if (!is_allowed_value(argument, value))
+            {
+                throw exception_type("Default value not allowed", name, value);
+            }
+
+            if (!entry.m_handler)
+            {
+                continue;
+            }
+
+            typed_value converted_value;
+            bool converted = false;
+            try
+            {
+                converted = entry.m_handler->convert(*m_dictionary, value, converted_value);
+            }
+            catch (const conversion_error&)
+            {
+                std::throw_with_nested(exception_type("Default value conversion failed", name, value));
+            }
+            if (!converted)
+            {
+                throw exception_type("Default value conversion failed", name, value);
+            }
+            entry.m_converted_values.push_back(std::move(converted_value));
+        }
+
+        return entry;
+    }
+
+    void fill_results_names_index(results_names_index_type& names_index, const string_type& prefix) const
+    {
+        for (auto& name_entry : m_names)
+        {
+            names_index.insert(prefix + name_entry.first, name_entry.second->get_slot());
+        }
+
+        if (!m_subparsers_argument)
+        {
+            return;
+        }
+
+        for (auto& subparser_entry : m_subparsers)
+        {
+            auto new_prefix = prefix + subparser_entry.first + m_dictionary->get_subparser_separator_literal();
+
+            subparser_entry.second->fill_results_names_index(names_index, new_prefix);
+        }
+    }
+
+    void fill_qualified_names(string_vector_type& qualified_names, const string_type& prefix) const
+    {
+        for (auto& argument : m_arguments)
+        {
+            qualified_names[argument->get_slot()] = prefix + argument->get_first_name();
+        }
+
+        for (auto& subparser_entry : m_subparsers)
+        {
+            auto new_prefix = prefix + subparser_entry.first + m_dictionary->get_subparser_separator_literal();
+
+            subparser_entry.second->fill_qualified_names(qualified_names, new_prefix);
+        }
+    }
+
+    std::size_t m_revision;
+    const_dictionary_ptr_type m_dictionary;
+    std::size_t m_dictionary_revision;
+    /// Dictionary literals used for each token (copied, so there is no virtual call per token).
+    string_type m_value_separator_literal;
+    string_type m_switch_enabled_literal;
+    parse_observer_ptr_type m_parse_observer;
+    std::size_t m_slot_count;
+    allowed_values_table_ptr_type m_allowed_values;
+    argument_vector_type m_arguments;
+    const_argument_ptr_type m_subparsers_argument;
+    /// Subsets of the arguments checked after parsing, so parser level costs do not grow with all arguments.
+    argument_list_type m_positional_arguments;
+    default_values_entry_vector_type m_default_values;
+    argument_list_type m_required_arguments;
+    name_entry_vector_type m_names;
+    basic_name_index<char_type, const argument_type*> m_names_index;
+    basic_first_char_filter<char_type> m_names_first_chars;
+    subparser_entry_vector_type m_subparsers;
+    basic_name_index<char_type, const basic_parser_snapshot*> m_subparsers_index;
+    /// Names (with subparser prefixes) to slots for results, built for root snapshot only.
+    const_results_names_index_ptr_type m_results_names_index;
+    /// Arguments first names with subparser prefixes by slot (for observers and visitors), root snapshot only.
+    string_vector_type m_qualified_names;
+};
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_PARSER_SNAPSHOT_HPP_
@@ -0,0 +1,56 @@
+#ifndef OCTARGS_PARSER_TREE_STATE_HPP_
+#define OCTARGS_PARSER_TREE_STATE_HPP_
+
+#include <cstddef>
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+/// \brief State shared by all parsers in a tree (root parser and all its subparsers).
+class parser_tree_state
+{
+public:
+    parser_tree_state()
+        : m_slot_count(0)
+        , m_revision(0)
+    {
+        // noop
+    }
+
+    std::size_t allocate_slot()
+    {
+        mark_modified();
+        return m_slot_count++;
+    }
+
+    std::size_t get_slot_count() const
+    {
+        return m_slot_count;
+    }
+
+    void mark_modified()
+    {
+        ++m_revision;
+    }
+
+    std::size_t get_revision() const
+    {
+        return m_revision;
+    }
+
+private:
+    /// Number of argument slots allocated so far (in the whole tree).
+    std::size_t m_slot_count;
+    /// Revision of the tree definition, changed on each modification.
+    std::size_t m_revision;
+};
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_PARSER_TREE_STATE_HPP_
@@ -28,8 +28,9 @@ public:
 
     using parser_data_weak_ptr_type = typename base_type::parser_data_weak_ptr_type;
 
-    explicit basic_positional_argument_impl(parser_data_weak_ptr_type parser_data_ptr, const string_vector_type& names)
-        : base_type(parser_data_ptr, base_type::ZERO_FLAGS, names)
+    explicit basic_positional_argument_impl(
+        parser_data_weak_ptr_type parser_data_ptr, std::size_t slot, const string_vector_type& names)
+        : base_type(parser_data_ptr, slot, base_type::ZERO_FLAGS, names)
     {
         // noop
     }
@@ -68,6 +69,11 @@ public:
     {
         base_type::set_max_count_unlimited();
     }
+
+    void set_values_as_range(bool enabled)
+    {
+        base_type::set_flag(base_type::FLAG_IS_STORING_VALUES_AS_RANGE, enabled);
+    }
 };
 
 } // namespace internal
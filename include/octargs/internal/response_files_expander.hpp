@@ -0,0 +1,144 @@
+#ifndef OCTARGS_RESPONSE_FILES_EXPANDER_HPP_
+#define OCTARGS_RESPONSE_FILES_EXPANDER_HPP_
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "../argument_table.hpp"
+#include "../exception.hpp"
+#include "../string_view.hpp"
+#include "file_mapping.hpp"
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+/// \brief Expands response files of the argument table (see expand_response_files())
+///
+/// \tparam char_T      char type (as in std::basic_string)
+template <typename char_T>
+class response_files_expander
+{
+public:
+    using char_type = char_T;
+
+    using argument_table_type = basic_argument_table<char_type>;
+    using string_view_type = basic_string_view<char_type>;
+    using string_view_vector_type = std::vector<string_view_type>;
+
+    static_assert(std::is_same<char_type, char>::value, "Response files are supported for char type only");
+
+    explicit response_files_expander(argument_table_type& table)
+        : m_table(table)
+        , m_active_files()
+    {
+        // noop
+    }
+
+    response_files_expander(const response_files_expander&) = delete;
+    response_files_expander& operator=(const response_files_expander&) = delete;
+
+    void expand(std::size_t max_depth)
+    {
+        auto& arguments = *m_table.m_arguments_ptr;
+
+        auto expanded_arguments_ptr = std::make_shared<string_view_vector_type>();
+        expanded_arguments_ptr->reserve(arguments.size());
+
+        expand_arguments(arguments.data(), arguments.data() + arguments.size(), *expanded_arguments_ptr, max_depth);
+
+        m_table.m_arguments_ptr = expanded_arguments_ptr;
+    }
+
+private:
+    using file_mapping_type = file_mapping;
+    using file_id_type = file_mapping_type::file_id;
+
+    static const char_type RESPONSE_FILE_PREFIX = '@';
+
+    void expand_arguments(const string_view_type* first, const string_view_type* last,
+        string_view_vector_type& expanded_arguments, std::size_t max_depth)
+    {
+        for (; first != last; ++first)
+        {
+            if ((first->size() > 1) && ((*first)[0] == RESPONSE_FILE_PREFIX))
+            {
+                expand_response_file(first->substr(1), expanded_arguments, max_depth);
+            }
+            else
+            {
+                expanded_arguments.push_back(*first);
+            }
+        }
+    }
+
+    void expand_response_file(string_view_type path, string_view_vector_type& expanded_arguments, std::size_t max_depth)
+    {
+        if (m_active_files.size() >= max_depth)
+        {
+            throw response_file_error_ex<char_type>("Response files nested too deep", path.to_string());
+        }
+
+        auto mapping_ptr = file_mapping_type::open(path.to_string());
+        if (!mapping_ptr)
+        {
+            throw response_file_error_ex<char_type>("Cannot read response file", path.to_string());
+        }
+
+        if (std::find(m_active_files.begin(), m_active_files.end(), mapping_ptr->get_id()) != m_active_files.end())
+        {
+            throw response_file_error_ex<char_type>("Response file includes itself", path.to_string());
+        }
+
+        m_table.m_response_files.push_back(mapping_ptr);
+
+        string_view_vector_type file_arguments;
+        tokenize(mapping_ptr->data(), mapping_ptr->size(), file_arguments);
+
+        m_active_files.push_back(mapping_ptr->get_id());
+        expand_arguments(
+            file_arguments.data(), file_arguments.data() + file_arguments.size(), expanded_arguments, max_depth);
+        m_active_files.pop_back();
+    }
+
+    static void tokenize(const char* data, std::size_t size, string_view_vector_type& arguments)
+    {
+        auto end = data + size;
+
+        bool nul_separated = (size > 0) && (std::memchr(data, '\0', size) != nullptr);
+        char separator = nul_separated ? '\0' : '\n';
+
+        while (data != end)
+        {
+            auto separator_ptr = static_cast<const char*>(std::memchr(data, separator, end - data));
+            auto token_end = separator_ptr ? separator_ptr : end;
+
+            auto token_size = static_cast<std::size_t>(token_end - data);
+            if (!nul_separated && (token_size > 0) && (data[token_size - 1] == '\r'))
+            {
+                --token_size;
+            }
+            if (token_size > 0)
+            {
+                arguments.emplace_back(data, token_size);
+            }
+
+            data = separator_ptr ? separator_ptr + 1 : end;
+        }
+    }
+
+    argument_table_type& m_table;
+    std::vector<file_id_type> m_active_files;
+};
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_RESPONSE_FILES_EXPANDER_HPP_
@@ -1,11 +1,17 @@
 #ifndef OCTARGS_RESULTS_DATA_HPP_
 #define OCTARGS_RESULTS_DATA_HPP_
 
-#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "../dictionary.hpp"
 #include "../exception.hpp"
-#include "string_utils.hpp"
+#include "../string_view.hpp"
+#include "argument.hpp"
+#include "name_index.hpp"
+#include "typed_value.hpp"
 
 namespace oct
 {
@@ -22,22 +28,61 @@ public:
 
     using string_type = std::basic_string<char_type>;
     using string_vector_type = std::vector<string_type>;
-    using string_less_type = string_less<char_type>;
+    using string_view_type = basic_string_view<char_type>;
+    using string_view_vector_type = std::vector<string_view_type>;
+    using const_string_view_vector_ptr_type = std::shared_ptr<const string_view_vector_type>;
+    using typed_value_vector_type = std::vector<typed_value>;
 
     using argument_tag_type = basic_argument_tag;
-    using const_argument_tag_ptr_type = std::shared_ptr<const argument_tag_type>;
+
+    using names_index_type = basic_name_index<char_type, std::size_t>;
+    using const_names_index_ptr_type = std::shared_ptr<const names_index_type>;
 
     using dictionary_type = dictionary<char_type>;
     using const_dictionary_ptr_type = std::shared_ptr<const dictionary_type>;
 
-    basic_results_data(bool case_sensitive)
+    basic_results_data(const const_names_index_ptr_type& names_index_ptr, std::size_t slot_count)
         : m_app_name()
-        , m_names_repository(case_sensitive)
-        , m_argument_values()
+        , m_names_index_ptr(names_index_ptr)
+        , m_argument_values(slot_count)
+        , m_converted_values(slot_count)
+        , m_value_ranges(slot_count)
+        , m_keep_alive_ptrs()
+        , m_values_cache_mutex()
+        , m_values_cache(slot_count)
+        , m_values_cached(slot_count, false)
+        , m_range_views_cache(slot_count)
     {
         // noop
     }
 
+    /// \brief Removes all stored values
+    ///
+    /// Names are kept and memory already allocated for values is reused.
+    void reset()
+    {
+        m_app_name.clear();
+        for (auto& values : m_argument_values)
+        {
+            values.clear();
+        }
+        for (auto& values : m_converted_values)
+        {
+            values.clear();
+        }
+        for (auto& range : m_value_ranges)
+        {
+            range = value_range();
+        }
+        m_keep_alive_ptrs.clear();
+        for (std::size_t i = 0; i < m_values_cache.size(); ++i)
+        {
+            m_values_cache[i].clear();
+            m_values_cached[i] = false;
+            m_range_views_cache[i].clear();
+        }
+    }
+
     const string_type& get_app_name() const
     {
         return m_app_name;
@@ -45,82 +90,144 @@ public:
 
     void set_app_name(const string_type& app_name)
     {
-        this->m_app_name = app_name;
+        this->m_app_name.assign(app_name);
     }
 
-    bool has_value(const const_argument_tag_ptr_type& arg_ptr) const
+    bool has_value(const argument_tag_type& argument) const
     {
-        return this->m_argument_values.find(arg_ptr) != this->m_argument_values.end();
+        return value_count(argument) > 0;
     }
 
-    std::size_t value_count(const const_argument_tag_ptr_type& arg_ptr) const
+    std::size_t value_count(const argument_tag_type& argument) const
     {
-        auto arg_values_iter = this->m_argument_values.find(arg_ptr);
-        if (arg_values_iter != this->m_argument_values.end())
-        {
-            return arg_values_iter->second.size();
-        }
-        else
+        return slot_value_count(argument.get_slot());
+    }
+
+    void append_value(const argument_tag_type& argument, string_view_type value)
+    {
+        m_argument_values[argument.get_slot()].emplace_back(value);
+    }
+
+    void append_value(const argument_tag_type& argument, string_view_type value, typed_value&& converted_value)
+    {
+        m_argument_values[argument.get_slot()].emplace_back(value);
+        m_converted_values[argument.get_slot()].emplace_back(std::move(converted_value));
+    }
+
+    /// \brief Stores values as a range of argument views
+    ///
+    /// The argument must not have any values stored. The views vector is kept
+    /// alive as long as the results.
+    void set_value_range(const argument_tag_type& argument, const const_string_view_vector_ptr_type& views_ptr,
+        std::size_t first_index, std::size_t count)
+    {
+        auto first = views_ptr->data() + first_index;
+        m_value_ranges[argument.get_slot()] = value_range(first, first + count);
+        add_keep_alive(views_ptr);
+    }
+
+    std::size_t find_slot(const string_type& arg_name) const
+    {
+        auto slot_ptr = m_names_index_ptr->find(arg_name);
+        if (!slot_ptr)
         {
-            return 0;
+            throw unknown_argument_ex<char_type>(arg_name);
         }
+
+        return *slot_ptr;
+    }
+
+    std::size_t get_count(const string_type& arg_name) const
+    {
+        return slot_value_count(find_slot(arg_name));
     }
 
-    void append_value(const const_argument_tag_ptr_type& arg_ptr, const string_type& value)
+    const string_view_vector_type& get_value_views(const string_type& arg_name) const
     {
-        auto arg_values_iter = this->m_argument_values.find(arg_ptr);
-        if (arg_values_iter != this->m_argument_values.end())
+        auto slot = find_slot(arg_name);
+
+        auto& range = m_value_ranges[slot];
+        if (range.empty())
         {
-            arg_values_iter->second.emplace_back(value);
+            return m_argument_values[slot];
         }
-        else
+
+        std::lock_guard<std::mutex> lock(m_values_cache_mutex);
+
+        auto& cached_views = m_range_views_cache[slot];
+        if (cached_views.empty())
         {
-            this->m_argument_values.emplace(arg_ptr, string_vector_type({ value }));
+            cached_views.assign(range.m_first, range.m_last);
         }
+        return cached_views;
     }
 
-    const_argument_tag_ptr_type find_argument(const string_type& arg_name) const
+    /// \brief Returns pointers to first and past the last value view
+    std::pair<const string_view_type*, const string_view_type*> get_value_range(const string_type& arg_name) const
     {
-        auto name_arg_iter = m_names_repository.find(arg_name);
-        if (name_arg_iter == m_names_repository.end())
+        auto slot = find_slot(arg_name);
+
+        auto& range = m_value_ranges[slot];
+        if (!range.empty())
         {
-            throw unknown_argument_ex<char_type>(arg_name);
+            return std::make_pair(range.m_first, range.m_last);
         }
 
-        return name_arg_iter->second;
+        auto& values = m_argument_values[slot];
+        return std::make_pair(values.data(), values.data() + values.size());
     }
 
-    std::size_t get_count(const string_type& arg_name) const
+    /// \brief Returns values converted during parsing by converter with given id
+    ///
+    /// Returns nullptr if values were not converted by such converter (or
+    /// there are no values).
+    const typed_value_vector_type* find_converted_values(const string_type& arg_name, type_id_type converter_id) const
     {
-        auto name_arg_iter = find_argument(arg_name);
-        auto values_iter = m_argument_values.find(name_arg_iter);
-        if (values_iter != m_argument_values.end())
-        {
-            return values_iter->second.size();
-        }
-        else
+        auto slot = find_slot(arg_name);
+
+        auto& converted_values = m_converted_values[slot];
+        if (!converter_id || converted_values.empty() || (converted_values.size() != m_argument_values[slot].size())
+            || (converted_values.front().get_tag() != converter_id))
         {
-            return 0;
+            return nullptr;
         }
+        return &converted_values;
     }
 
     const string_vector_type& get_values(const string_type& arg_name) const
     {
-        auto name_arg_iter = find_argument(arg_name);
-        auto values_iter = m_argument_values.find(name_arg_iter);
-        if (values_iter != m_argument_values.end())
-        {
-            return values_iter->second;
-        }
-        else
+        auto slot = find_slot(arg_name);
+
+        std::lock_guard<std::mutex> lock(m_values_cache_mutex);
+
+        auto& cached_values = m_values_cache[slot];
+        if (!m_values_cached[slot])
         {
-            return get_empty_values();
+            auto& range = m_value_ranges[slot];
+            auto& values = m_argument_values[slot];
+
+            auto first = range.empty() ? values.data() : range.m_first;
+            auto last = range.empty() ? values.data() + values.size() : range.m_last;
+
+            cached_values.reserve(static_cast<std::size_t>(last - first));
+            for (; first != last; ++first)
+            {
+                cached_values.emplace_back(first->to_string());
+            }
+            m_values_cached[slot] = true;
         }
+        return cached_values;
     }
 
-    void add_name(const string_type& name, const_argument_tag_ptr_type tag)
+    /// \brief Keeps the given object alive as long as the results
+    ///
+    /// Used for objects owning the strings referenced by the stored values.
+    void add_keep_alive(const std::shared_ptr<const void>& object_ptr)
     {
-        m_names_repository.emplace(name, tag);
+        if (object_ptr)
+        {
+            m_keep_alive_ptrs.push_back(object_ptr);
+        }
     }
 
     static const string_vector_type& get_empty_value()
@@ -136,9 +243,57 @@ public:
     }
 
 private:
+    class value_range
+    {
+    public:
+        value_range()
+            : m_first(nullptr)
+            , m_last(nullptr)
+        {
+            // noop
+        }
+
+        value_range(const string_view_type* first, const string_view_type* last)
+            : m_first(first)
+            , m_last(last)
+        {
+            // noop
+        }
+
+        bool empty() const
+        {
+            return m_first == m_last;
+        }
+
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(m_last - m_first);
+        }
+
+        const string_view_type* m_first;
+        const string_view_type* m_last;
+    };
+
+    std::size_t slot_value_count(std::size_t slot) const
+    {
+        return m_argument_values[slot].size() + m_value_ranges[slot].size();
+    }
+
     string_type m_app_name;
-    std::map<string_type, const_argument_tag_ptr_type, string_less_type> m_names_repository;
-    std::map<const_argument_tag_ptr_type, string_vector_type> m_argument_values;
+    /// Full argument names (with subparser prefixes) to slots, shared by all results of the parser.
+    const_names_index_ptr_type m_names_index_ptr;
+    std::vector<string_view_vector_type> m_argument_values;
+    /// Values converted by argument handlers (parallel to m_argument_values if the argument has a type).
+    std::vector<typed_value_vector_type> m_converted_values;
+    /// Values stored as ranges of argument views (used instead of m_argument_values).
+    std::vector<value_range> m_value_ranges;
+    std::vector<std::shared_ptr<const void>> m_keep_alive_ptrs;
+    /// Values converted to strings on first request (see get_values()).
+    mutable std::mutex m_values_cache_mutex;
+    mutable std::vector<string_vector_type> m_values_cache;
+    mutable std::vector<bool> m_values_cached;
+    /// Views of values stored as ranges, copied on first request (see get_value_views()).
+    mutable std::vector<string_view_vector_type> m_range_views_cache;
 };
 
 } // namespace internal
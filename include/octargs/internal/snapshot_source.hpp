@@ -0,0 +1,75 @@
+#ifndef OCTARGS_SNAPSHOT_SOURCE_HPP_
+#define OCTARGS_SNAPSHOT_SOURCE_HPP_
+
+#include <memory>
+
+#include "parser_data.hpp"
+#include "parser_snapshot.hpp"
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+/// \brief Snapshot source taking the (cached) snapshot of the current parser definition
+///
+/// \tparam char_T              char type (as in std::basic_string)
+/// \tparam values_storage_T    type of class uses as a storage for parsed values
+template <typename char_T, typename values_storage_T>
+class parser_data_snapshot_source
+{
+public:
+    using snapshot_type = basic_parser_snapshot<char_T, values_storage_T>;
+    using const_snapshot_ptr_type = std::shared_ptr<const snapshot_type>;
+
+    using parser_data_type = basic_parser_data<char_T, values_storage_T>;
+    using parser_data_ptr_type = std::shared_ptr<parser_data_type>;
+
+    explicit parser_data_snapshot_source(const parser_data_ptr_type& data_ptr)
+        : m_data_ptr(data_ptr)
+    {
+        // noop
+    }
+
+    const_snapshot_ptr_type get_snapshot() const
+    {
+        return snapshot_type::get(*m_data_ptr);
+    }
+
+private:
+    parser_data_ptr_type m_data_ptr;
+};
+
+/// \brief Snapshot source using a fixed snapshot (taken when the parser was compiled)
+///
+/// \tparam char_T              char type (as in std::basic_string)
+/// \tparam values_storage_T    type of class uses as a storage for parsed values
+template <typename char_T, typename values_storage_T>
+class fixed_snapshot_source
+{
+public:
+    using snapshot_type = basic_parser_snapshot<char_T, values_storage_T>;
+    using const_snapshot_ptr_type = std::shared_ptr<const snapshot_type>;
+
+    explicit fixed_snapshot_source(const const_snapshot_ptr_type& snapshot_ptr)
+        : m_snapshot_ptr(snapshot_ptr)
+    {
+        // noop
+    }
+
+    const const_snapshot_ptr_type& get_snapshot() const
+    {
+        return m_snapshot_ptr;
+    }
+
+private:
+    const_snapshot_ptr_type m_snapshot_ptr;
+};
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_SNAPSHOT_SOURCE_HPP_
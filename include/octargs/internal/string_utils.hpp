@@ -3,6 +3,8 @@
 
 #include <algorithm>
 
+#include "../string_view.hpp"
+#include "case_folding.hpp"
 #include "char_utils.hpp"
 
 namespace oct
@@ -135,11 +137,11 @@ public:
             std::size_t len2 = str2.size();
             for (std::size_t i = 0; (i < len1) && (i < len2); ++i)
             {
-                if (to_lower(str1[i]) < to_lower(str2[i]))
+                if (fold_case(str1[i]) < fold_case(str2[i]))
                 {
                     return true;
                 }
-                if (to_lower(str1[i]) > to_lower(str2[i]))
+                if (fold_case(str1[i]) > fold_case(str2[i]))
                 {
                     return false;
                 }
@@ -165,7 +167,7 @@ class string_equal
 {
 public:
     using char_type = char_T;
-    using string_type = std::basic_string<char_type>;
+    using string_view_type = basic_string_view<char_type>;
 
     string_equal(bool case_sensitive)
         : m_case_sensitive(case_sensitive)
@@ -173,7 +175,7 @@ public:
         // noop
     }
 
-    bool operator()(const string_type& str1, const string_type& str2) const
+    bool operator()(string_view_type str1, string_view_type str2) const
     {
         if (m_case_sensitive)
         {
@@ -181,21 +183,7 @@ public:
         }
         else
         {
-            std::size_t len1 = str1.size();
-            std::size_t len2 = str2.size();
-            if (len1 != len2)
-            {
-                return false;
-            }
-
-            for (std::size_t i = 0; i < len1; ++i)
-            {
-                if (to_lower(str1[i]) != to_lower(str2[i]))
-                {
-                    return false;
-                }
-            }
-            return true;
+            return (str1.size() == str2.size()) && equal_ignore_case(str1.data(), str2.data(), str1.size());
         }
     }
 
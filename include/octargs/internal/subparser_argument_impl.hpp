@@ -37,8 +37,9 @@ public:
 
     using parser_data_weak_ptr_type = typename base_type::parser_data_weak_ptr_type;
 
-    explicit basic_subparser_argument_impl(parser_data_weak_ptr_type parser_data_ptr, const string_vector_type& names)
-        : base_type(parser_data_ptr, base_type::ZERO_FLAGS, names)
+    explicit basic_subparser_argument_impl(
+        parser_data_weak_ptr_type parser_data_ptr, std::size_t slot, const string_vector_type& names)
+        : base_type(parser_data_ptr, slot, base_type::ZERO_FLAGS, names)
     {
         base_type::set_min_count(1);
     }
@@ -0,0 +1,269 @@
+#ifndef OCTARGS_TYPED_VALUE_HPP_
+#define OCTARGS_TYPED_VALUE_HPP_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace oct
+{
+namespace args
+{
+namespace internal
+{
+
+using type_id_type = const void*;
+
+/// \brief Type identifier holder
+///
+/// Identifier is a mutable object, so linkers folding identical constants
+/// (e.g. identical code folding) cannot merge identifiers of different types.
+template <typename T>
+class type_id_helper
+{
+public:
+    static char ID;
+};
+
+template <typename T>
+char type_id_helper<T>::ID = 0;
+
+/// \brief Returns identifier unique for the given type (RTTI is not required)
+template <typename T>
+type_id_type get_type_id()
+{
+    return &type_id_helper<typename std::decay<T>::type>::ID;
+}
+
+/// \brief Type erased value
+///
+/// Values of small types (that could be moved without exceptions) are stored
+/// in the internal buffer, bigger values are allocated on the heap.
+///
+/// In addition to the value the object stores a tag - identifier of the
+/// value origin (e.g. type of the converter that produced the value).
+class typed_value
+{
+public:
+    typed_value()
+        : m_operations(nullptr)
+        , m_tag(nullptr)
+        , m_storage()
+    {
+        // noop
+    }
+
+    typed_value(const typed_value& other)
+        : m_operations(nullptr)
+        , m_tag(nullptr)
+        , m_storage()
+    {
+        copy_from(other);
+    }
+
+    typed_value(typed_value&& other) noexcept
+        : m_operations(nullptr)
+        , m_tag(nullptr)
+        , m_storage()
+    {
+        move_from(other);
+    }
+
+    ~typed_value()
+    {
+        reset();
+    }
+
+    typed_value& operator=(const typed_value& other)
+    {
+        if (this != &other)
+        {
+            reset();
+            copy_from(other);
+        }
+        return *this;
+    }
+
+    typed_value& operator=(typed_value&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    bool empty() const
+    {
+        return m_operations == nullptr;
+    }
+
+    type_id_type get_tag() const
+    {
+        return m_tag;
+    }
+
+    void reset()
+    {
+        if (m_operations)
+        {
+            m_operations->m_destroy(m_storage);
+            m_operations = nullptr;
+        }
+        m_tag = nullptr;
+    }
+
+    template <typename data_T>
+    void emplace(type_id_type tag, data_T&& value)
+    {
+        using data_type = typename std::decay<data_T>::type;
+
+        reset();
+        handler<data_type>::create(m_storage, std::forward<data_T>(value));
+        m_operations = &handler<data_type>::OPERATIONS;
+        m_tag = tag;
+    }
+
+    /// \brief Returns pointer to the value or nullptr if value is not of given type
+    template <typename data_T>
+    const data_T* get() const
+    {
+        if (m_operations != &handler<data_T>::OPERATIONS)
+        {
+            return nullptr;
+        }
+        return handler<data_T>::get(m_storage);
+    }
+
+private:
+    static const std::size_t BUFFER_SIZE = 4 * sizeof(void*);
+
+    union storage
+    {
+        void* m_heap_ptr;
+        typename std::aligned_storage<BUFFER_SIZE>::type m_buffer;
+    };
+
+    struct operations
+    {
+        void (*m_destroy)(storage& storage);
+        void (*m_copy)(storage& dst, const storage& src);
+        void (*m_move)(storage& dst, storage& src);
+    };
+
+    template <typename data_T>
+    using is_stored_inline = std::integral_constant<bool,
+        (sizeof(data_T) <= BUFFER_SIZE) && (alignof(data_T) <= alignof(storage))
+            && std::is_nothrow_move_constructible<data_T>::value>;
+
+    template <typename data_T, bool inline_V = is_stored_inline<data_T>::value>
+    class handler
+    {
+    public:
+        template <typename arg_T>
+        static void create(storage& storage, arg_T&& value)
+        {
+            new (&storage.m_buffer) data_T(std::forward<arg_T>(value));
+        }
+
+        static const data_T* get(const storage& storage)
+        {
+            return reinterpret_cast<const data_T*>(&storage.m_buffer);
+        }
+
+        static void destroy(storage& storage)
+        {
+            reinterpret_cast<data_T*>(&storage.m_buffer)->~data_T();
+        }
+
+        static void copy(storage& dst, const storage& src)
+        {
+            create(dst, *get(src));
+        }
+
+        static void move(storage& dst, storage& src)
+        {
+            create(dst, std::move(*reinterpret_cast<data_T*>(&src.m_buffer)));
+            destroy(src);
+        }
+
+        // mutable (not folded with operations of other types with identical functions)
+        static operations OPERATIONS;
+    };
+
+    template <typename data_T>
+    class handler<data_T, false>
+    {
+    public:
+        template <typename arg_T>
+        static void create(storage& storage, arg_T&& value)
+        {
+            storage.m_heap_ptr = new data_T(std::forward<arg_T>(value));
+        }
+
+        static const data_T* get(const storage& storage)
+        {
+            return static_cast<const data_T*>(storage.m_heap_ptr);
+        }
+
+        static void destroy(storage& storage)
+        {
+            delete static_cast<data_T*>(storage.m_heap_ptr);
+        }
+
+        static void copy(storage& dst, const storage& src)
+        {
+            create(dst, *get(src));
+        }
+
+        static void move(storage& dst, storage& src)
+        {
+            dst.m_heap_ptr = src.m_heap_ptr;
+        }
+
+        // mutable (not folded with operations of other types with identical functions)
+        static operations OPERATIONS;
+    };
+
+    void copy_from(const typed_value& other)
+    {
+        if (other.m_operations)
+        {
+            other.m_operations->m_copy(m_storage, other.m_storage);
+            m_operations = other.m_operations;
+            m_tag = other.m_tag;
+        }
+    }
+
+    void move_from(typed_value& other)
+    {
+        if (other.m_operations)
+        {
+            other.m_operations->m_move(m_storage, other.m_storage);
+            m_operations = other.m_operations;
+            m_tag = other.m_tag;
+            other.m_operations = nullptr;
+            other.m_tag = nullptr;
+        }
+    }
+
+    const operations* m_operations;
+    type_id_type m_tag;
+    storage m_storage;
+};
+
+template <typename data_T, bool inline_V>
+typename typed_value::operations typed_value::handler<data_T, inline_V>::OPERATIONS
+    = { &handler::destroy, &handler::copy, &handler::move };
+
+template <typename data_T>
+typename typed_value::operations typed_value::handler<data_T, false>::OPERATIONS
+    = { &handler::destroy, &handler::copy, &handler::move };
+
+} // namespace internal
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_TYPED_VALUE_HPP_
@@ -26,8 +26,9 @@ public:
 
     using parser_data_weak_ptr_type = typename base_type::parser_data_weak_ptr_type;
 
-    explicit basic_valued_argument_impl(parser_data_weak_ptr_type parser_data_ptr, const string_vector_type& names)
-        : base_type(parser_data_ptr,
+    explicit basic_valued_argument_impl(
+        parser_data_weak_ptr_type parser_data_ptr, std::size_t slot, const string_vector_type& names)
+        : base_type(parser_data_ptr, slot,
             base_type::FLAG_IS_ASSIGNABLE_BY_NAME | base_type::FLAG_IS_ACCEPTING_IMMEDIATE_VALUE
                 | base_type::FLAG_IS_ACCEPTING_SEPARATE_VALUE,
             names)
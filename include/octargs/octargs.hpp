@@ -2,8 +2,15 @@
 #define OCTARGS_OCTARGS_HPP_
 
 #include "argument_table.hpp"
+#include "parse_context.hpp"
+#include "parse_observer.hpp"
+#include "parse_result.hpp"
+#include "parse_statistics.hpp"
+#include "parse_visitor.hpp"
 #include "parser.hpp"
 #include "results.hpp"
+#include "validation_result.hpp"
+#include "values_range.hpp"
 
 /// \brief OCTAEDR Software
 namespace oct
@@ -30,12 +37,66 @@ using results = basic_results<char>;
 /// \brief Argument parsing results (for wchar_t/wstring)
 using wresults = basic_results<wchar_t>;
 
+/// \brief Argument values range (for char/string)
+using values_range = basic_values_range<char>;
+
+/// \brief Argument values range (for wchar_t/wstring)
+using wvalues_range = basic_values_range<wchar_t>;
+
+/// \brief Parse context (for char/string)
+using parse_context = basic_parse_context<char>;
+
+/// \brief Parse context (for wchar_t/wstring)
+using wparse_context = basic_parse_context<wchar_t>;
+
+/// \brief Parse result (for char/string)
+using parse_result = basic_parse_result<char>;
+
+/// \brief Parse result (for wchar_t/wstring)
+using wparse_result = basic_parse_result<wchar_t>;
+
+/// \brief Validation result (for char/string)
+using validation_result = basic_validation_result<char>;
+
+/// \brief Validation result (for wchar_t/wstring)
+using wvalidation_result = basic_validation_result<wchar_t>;
+
+/// \brief Parse visitor (for char/string)
+using parse_visitor = basic_parse_visitor<char>;
+
+/// \brief Parse visitor (for wchar_t/wstring)
+using wparse_visitor = basic_parse_visitor<wchar_t>;
+
+/// \brief Parse visitor argument handle (for char/string)
+using argument_handle = basic_argument_handle<char>;
+
+/// \brief Parse visitor argument handle (for wchar_t/wstring)
+using wargument_handle = basic_argument_handle<wchar_t>;
+
+/// \brief Parse observer (for char/string)
+using parse_observer = basic_parse_observer<char>;
+
+/// \brief Parse observer (for wchar_t/wstring)
+using wparse_observer = basic_parse_observer<wchar_t>;
+
+/// \brief Parse statistics (for char/string)
+using parse_statistics = basic_parse_statistics<char>;
+
+/// \brief Parse statistics (for wchar_t/wstring)
+using wparse_statistics = basic_parse_statistics<wchar_t>;
+
 /// \brief Parser (for char/string)
 using parser = basic_parser<char, void>;
 
 /// \brief Parser (for wchar_t/wstring)
 using wparser = basic_parser<wchar_t, void>;
 
+/// \brief Compiled parser (for char/string)
+using compiled_parser = basic_compiled_parser<char, void>;
+
+/// \brief Compiled parser (for wchar_t/wstring)
+using wcompiled_parser = basic_compiled_parser<wchar_t, void>;
+
 /// \brief Parser with values storage (for char/string)
 template <typename values_storage_T>
 using storing_parser = basic_parser<char, values_storage_T>;
@@ -44,6 +105,14 @@ using storing_parser = basic_parser<char, values_storage_T>;
 template <typename values_storage_T>
 using wstoring_parser = basic_parser<wchar_t, values_storage_T>;
 
+/// \brief Compiled parser with values storage (for char/string)
+template <typename values_storage_T>
+using compiled_storing_parser = basic_compiled_parser<char, values_storage_T>;
+
+/// \brief Compiled parser with values storage (for wchar_t/wstring)
+template <typename values_storage_T>
+using wcompiled_storing_parser = basic_compiled_parser<wchar_t, values_storage_T>;
+
 } // namespace args
 } // namespace oct
 
@@ -0,0 +1,334 @@
+#ifndef OCTARGS_PARSE_API_HPP_
+#define OCTARGS_PARSE_API_HPP_
+
+#include <memory>
+#include <vector>
+
+#include "argument_table.hpp"
+#include "parse_context.hpp"
+#include "parse_result.hpp"
+#include "parse_visitor.hpp"
+#include "results.hpp"
+#include "validation_result.hpp"
+
+#include "internal/batch_parser_engine.hpp"
+#include "internal/parser_engine.hpp"
+#include "internal/parser_snapshot.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+/// \brief Parse functions base (common for parsers and compiled parsers)
+///
+/// Parse functions work on the snapshot returned by the snapshot source
+/// (snapshot of the current parser definition for parsers, the snapshot
+/// taken at compilation for compiled parsers).
+///
+/// \tparam char_T              char type (as in std::basic_string)
+/// \tparam values_storage_T    type of class uses as a storage for parsed values
+/// \tparam snapshot_source_T   type providing the parser snapshot (get_snapshot())
+template <typename char_T, typename values_storage_T, typename snapshot_source_T>
+class basic_parse_api_base
+{
+public:
+    using char_type = char_T;
+    using values_storage_type = values_storage_T;
+
+    using argument_table_type = basic_argument_table<char_type>;
+    using results_type = basic_results<char_type>;
+
+    using parse_context_type = basic_parse_context<char_type>;
+
+    using parse_visitor_type = basic_parse_visitor<char_type>;
+
+    using parse_result_type = basic_parse_result<char_type>;
+
+    using validation_result_type = basic_validation_result<char_type>;
+
+    /// \brief Validates arguments without creating results
+    ///
+    /// Applies all the parsing rules (including converters and check functions)
+    /// but values are only counted and never stored (storage handlers are not
+    /// called). Cheaper than try_parse() when only the first error (if any) is
+    /// needed. For valid arguments the engine allocates no memory (values
+    /// counters are kept in a per thread buffer allocated by the first call).
+    validation_result_type validate(const argument_table_type& arg_table) const
+    {
+        const auto& snapshot_ptr = m_snapshot_source.get_snapshot();
+
+        validating_engine_type engine(arg_table, snapshot_ptr);
+        return engine.validate();
+    }
+
+protected:
+    using snapshot_source_type = snapshot_source_T;
+
+    using storage_helper_type = internal::storage_handler_helper<char_type, values_storage_type>;
+
+    using engine_type = internal::basic_parser_engine<char_type, values_storage_type>;
+    using visiting_engine_type = internal::basic_visiting_parser_engine<char_type, values_storage_type>;
+    using validating_engine_type = internal::basic_validating_parser_engine<char_type, values_storage_type>;
+    using batch_engine_type = internal::basic_batch_parser_engine<char_type, values_storage_type>;
+
+    explicit basic_parse_api_base(const snapshot_source_type& snapshot_source)
+        : m_snapshot_source(snapshot_source)
+    {
+        // noop
+    }
+
+    results_type parse_internal(const argument_table_type& arg_table, storage_helper_type& storage_helper) const
+    {
+        const auto& snapshot_ptr = m_snapshot_source.get_snapshot();
+
+        engine_type engine(arg_table, storage_helper, snapshot_ptr, snapshot_ptr->create_results_data());
+        return engine.parse();
+    }
+
+    results_type parse_internal(const argument_table_type& arg_table, storage_helper_type& storage_helper,
+        parse_context_type& context) const
+    {
+        const auto& snapshot_ptr = m_snapshot_source.get_snapshot();
+
+        engine_type engine(arg_table, storage_helper, snapshot_ptr, context.prepare_results_data(snapshot_ptr));
+        return engine.parse();
+    }
+
+    parse_result_type try_parse_internal(
+        const argument_table_type& arg_table, storage_helper_type& storage_helper) const
+    {
+        const auto& snapshot_ptr = m_snapshot_source.get_snapshot();
+
+        engine_type engine(arg_table, storage_helper, snapshot_ptr, snapshot_ptr->create_results_data());
+        return engine.try_parse();
+    }
+
+    parse_result_type try_parse_internal(const argument_table_type& arg_table, storage_helper_type& storage_helper,
+        parse_context_type& context) const
+    {
+        const auto& snapshot_ptr = m_snapshot_source.get_snapshot();
+
+        engine_type engine(arg_table, storage_helper, snapshot_ptr, context.prepare_results_data(snapshot_ptr));
+        return engine.try_parse();
+    }
+
+    void visit_internal(
+        const argument_table_type& arg_table, storage_helper_type& storage_helper, parse_visitor_type& visitor) const
+    {
+        const auto& snapshot_ptr = m_snapshot_source.get_snapshot();
+
+        visiting_engine_type engine(arg_table, storage_helper, *snapshot_ptr, visitor);
+        engine.parse();
+    }
+
+    template <typename iterator_T>
+    std::vector<parse_result_type> parse_batch_internal(
+        iterator_T first, iterator_T last, std::size_t thread_count) const
+    {
+        const auto& snapshot_ptr = m_snapshot_source.get_snapshot();
+
+        batch_engine_type engine(snapshot_ptr, thread_count);
+        return engine.parse(first, last);
+    }
+
+private:
+    snapshot_source_type m_snapshot_source;
+};
+
+/// \brief Parse functions (common for parsers and compiled parsers)
+///
+/// \tparam char_T              char type (as in std::basic_string)
+/// \tparam values_storage_T    type of class uses as a storage for parsed values
+/// \tparam snapshot_source_T   type providing the parser snapshot (get_snapshot())
+template <typename char_T, typename values_storage_T, typename snapshot_source_T>
+class basic_parse_api : public basic_parse_api_base<char_T, values_storage_T, snapshot_source_T>
+{
+public:
+    using char_type = char_T;
+    using values_storage_type = values_storage_T;
+
+    using base_type = basic_parse_api_base<char_T, values_storage_T, snapshot_source_T>;
+
+    using argument_table_type = typename base_type::argument_table_type;
+    using results_type = typename base_type::results_type;
+    using parse_context_type = typename base_type::parse_context_type;
+    using parse_visitor_type = typename base_type::parse_visitor_type;
+    using parse_result_type = typename base_type::parse_result_type;
+
+    results_type parse(int argc, char_type* argv[], values_storage_type& values_storage) const
+    {
+        return this->parse_internal(argument_table_type(argc, argv), values_storage);
+    }
+
+    results_type parse(int argc, const char_type* argv[], values_storage_type& values_storage) const
+    {
+        return this->parse_internal(argument_table_type(argc, argv), values_storage);
+    }
+
+    results_type parse(const argument_table_type& arg_table, values_storage_type& values_storage) const
+    {
+        return this->parse_internal(arg_table, values_storage);
+    }
+
+    results_type parse(int argc, const char_type* const argv[], values_storage_type& values_storage,
+        parse_context_type& context) const
+    {
+        return this->parse(context.prepare_argument_table(argc, argv), values_storage, context);
+    }
+
+    results_type parse(
+        const argument_table_type& arg_table, values_storage_type& values_storage, parse_context_type& context) const
+    {
+        typename base_type::storage_helper_type helper(values_storage);
+        return base_type::parse_internal(arg_table, helper, context);
+    }
+
+    /// \brief Parses arguments passing the values to visitor (results are not stored)
+    void visit(const argument_table_type& arg_table, values_storage_type& values_storage,
+        parse_visitor_type& visitor) const
+    {
+        typename base_type::storage_helper_type helper(values_storage);
+        base_type::visit_internal(arg_table, helper, visitor);
+    }
+
+    /// \brief Parses arguments without throwing parsing errors
+    ///
+    /// Returns results or description of the first error. Built-in converters
+    /// do not throw, exceptions thrown by custom converters and check functions
+    /// are caught (conversion_error) or passed through.
+    parse_result_type try_parse(const argument_table_type& arg_table, values_storage_type& values_storage) const
+    {
+        typename base_type::storage_helper_type helper(values_storage);
+        return base_type::try_parse_internal(arg_table, helper);
+    }
+
+    parse_result_type try_parse(
+        const argument_table_type& arg_table, values_storage_type& values_storage, parse_context_type& context) const
+    {
+        typename base_type::storage_helper_type helper(values_storage);
+        return base_type::try_parse_internal(arg_table, helper, context);
+    }
+
+protected:
+    explicit basic_parse_api(const typename base_type::snapshot_source_type& snapshot_source)
+        : base_type(snapshot_source)
+    {
+        // noop
+    }
+
+private:
+    results_type parse_internal(const argument_table_type& arg_table, values_storage_type& values_storage) const
+    {
+        typename base_type::storage_helper_type helper(values_storage);
+        return base_type::parse_internal(arg_table, helper);
+    }
+};
+
+/// \brief Parse functions (common for parsers and compiled parsers)
+///
+/// \tparam char_T              char type (as in std::basic_string)
+/// \tparam snapshot_source_T   type providing the parser snapshot (get_snapshot())
+template <typename char_T, typename snapshot_source_T>
+class basic_parse_api<char_T, void, snapshot_source_T> : public basic_parse_api_base<char_T, void, snapshot_source_T>
+{
+public:
+    using char_type = char_T;
+    using values_storage_type = void;
+
+    using base_type = basic_parse_api_base<char_T, void, snapshot_source_T>;
+
+    using argument_table_type = typename base_type::argument_table_type;
+    using results_type = typename base_type::results_type;
+    using parse_context_type = typename base_type::parse_context_type;
+    using parse_visitor_type = typename base_type::parse_visitor_type;
+    using parse_result_type = typename base_type::parse_result_type;
+
+    results_type parse(int argc, char_type* argv[]) const
+    {
+        return this->parse_internal(argument_table_type(argc, argv));
+    }
+
+    results_type parse(int argc, const char_type* argv[]) const
+    {
+        return this->parse_internal(argument_table_type(argc, argv));
+    }
+
+    results_type parse(const argument_table_type& arg_table) const
+    {
+        return this->parse_internal(arg_table);
+    }
+
+    results_type parse(int argc, const char_type* const argv[], parse_context_type& context) const
+    {
+        return this->parse(context.prepare_argument_table(argc, argv), context);
+    }
+
+    results_type parse(const argument_table_type& arg_table, parse_context_type& context) const
+    {
+        typename base_type::storage_helper_type helper;
+        return base_type::parse_internal(arg_table, helper, context);
+    }
+
+    /// \brief Parses arguments passing the values to visitor (results are not stored)
+    void visit(const argument_table_type& arg_table, parse_visitor_type& visitor) const
+    {
+        typename base_type::storage_helper_type helper;
+        base_type::visit_internal(arg_table, helper, visitor);
+    }
+
+    /// \brief Parses arguments without throwing parsing errors
+    ///
+    /// Returns results or description of the first error. Built-in converters
+    /// do not throw, exceptions thrown by custom converters and check functions
+    /// are caught (conversion_error) or passed through.
+    parse_result_type try_parse(const argument_table_type& arg_table) const
+    {
+        typename base_type::storage_helper_type helper;
+        return base_type::try_parse_internal(arg_table, helper);
+    }
+
+    parse_result_type try_parse(const argument_table_type& arg_table, parse_context_type& context) const
+    {
+        typename base_type::storage_helper_type helper;
+        return base_type::try_parse_internal(arg_table, helper, context);
+    }
+
+    /// \brief Parses many argument tables concurrently
+    ///
+    /// Each table is parsed as by try_parse(). Parsing is distributed among
+    /// the given number of threads (calling thread included, zero selects the
+    /// number of hardware threads) and the results are returned in the input
+    /// order. Custom handlers (converters, checkers) must be thread safe.
+    std::vector<parse_result_type> parse_batch(
+        const std::vector<argument_table_type>& arg_tables, std::size_t thread_count = 0) const
+    {
+        return base_type::parse_batch_internal(arg_tables.begin(), arg_tables.end(), thread_count);
+    }
+
+    /// \brief Parses range of argument tables concurrently (random access iterators)
+    template <typename iterator_T>
+    std::vector<parse_result_type> parse_batch(iterator_T first, iterator_T last, std::size_t thread_count = 0) const
+    {
+        return base_type::parse_batch_internal(first, last, thread_count);
+    }
+
+protected:
+    explicit basic_parse_api(const typename base_type::snapshot_source_type& snapshot_source)
+        : base_type(snapshot_source)
+    {
+        // noop
+    }
+
+private:
+    results_type parse_internal(const argument_table_type& arg_table) const
+    {
+        typename base_type::storage_helper_type helper;
+        return base_type::parse_internal(arg_table, helper);
+    }
+};
+
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_PARSE_API_HPP_
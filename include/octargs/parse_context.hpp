@@ -0,0 +1,96 @@
+#ifndef OCTARGS_PARSE_CONTEXT_HPP_
+#define OCTARGS_PARSE_CONTEXT_HPP_
+
+#include <memory>
+
+#include "argument_table.hpp"
+
+#include "internal/results_data.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+/// \brief Reusable parse context
+///
+/// Context owns the memory used by the parse calls (argument table holding a
+/// copy of argc + argv input and results data) and reuses it in subsequent
+/// calls, so when the same parser is used to parse many command lines the
+/// steady state parse does not allocate memory.
+///
+/// Results returned by a parse call using the context share the data with the
+/// context. The data is reused by the next parse call only if the previous
+/// results are no longer referenced (otherwise new data is allocated).
+///
+/// Context is not thread safe - each thread shall use its own context.
+///
+/// \tparam char_T              char type (as in std::basic_string)
+template <typename char_T>
+class basic_parse_context
+{
+public:
+    using char_type = char_T;
+
+    using argument_table_type = basic_argument_table<char_type>;
+
+    using results_data_type = internal::basic_results_data<char_type>;
+    using results_data_ptr_type = std::shared_ptr<results_data_type>;
+
+    basic_parse_context()
+        : m_arg_table()
+        , m_snapshot_ptr()
+        , m_results_data_ptr()
+    {
+        // noop
+    }
+
+    basic_parse_context(const basic_parse_context&) = delete;
+    basic_parse_context& operator=(const basic_parse_context&) = delete;
+
+    /// \brief Releases all memory owned by the context
+    void clear()
+    {
+        m_arg_table = argument_table_type();
+        m_snapshot_ptr.reset();
+        m_results_data_ptr.reset();
+    }
+
+    /// \brief Returns context argument table filled with a copy of argc + argv (used by parsers)
+    const argument_table_type& prepare_argument_table(int argc, const char_type* const argv[])
+    {
+        // previous results data references the table memory, release it so the memory is reused
+        if (m_results_data_ptr && (m_results_data_ptr.use_count() == 1))
+        {
+            m_results_data_ptr->reset();
+        }
+        m_arg_table.assign(argc, argv);
+        return m_arg_table;
+    }
+
+    /// \brief Returns empty results data for the given parser snapshot (used by parsers)
+    template <typename snapshot_T>
+    const results_data_ptr_type& prepare_results_data(const std::shared_ptr<const snapshot_T>& snapshot_ptr)
+    {
+        if (m_results_data_ptr && (m_snapshot_ptr == snapshot_ptr) && (m_results_data_ptr.use_count() == 1))
+        {
+            m_results_data_ptr->reset();
+        }
+        else
+        {
+            m_results_data_ptr = snapshot_ptr->create_results_data();
+            m_snapshot_ptr = snapshot_ptr;
+        }
+        return m_results_data_ptr;
+    }
+
+private:
+    argument_table_type m_arg_table;
+    std::shared_ptr<const void> m_snapshot_ptr;
+    results_data_ptr_type m_results_data_ptr;
+};
+
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_PARSE_CONTEXT_HPP_
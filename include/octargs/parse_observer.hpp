@@ -0,0 +1,120 @@
+#ifndef OCTARGS_PARSE_OBSERVER_HPP_
+#define OCTARGS_PARSE_OBSERVER_HPP_
+
+#include <chrono>
+#include <cstddef>
+
+#include "parse_visitor.hpp"
+#include "string_view.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+/// \brief Parsing phases reported to parse observer
+enum class parse_phase
+{
+    /// Leading arguments resolution (exclusive argument and subparser names detection).
+    LEADING_ARGUMENTS,
+    NAMED_ARGUMENTS,
+    POSITIONAL_ARGUMENTS,
+    DEFAULT_VALUES,
+    VALUES_COUNT_CHECK,
+};
+
+/// \brief Number of parse_phase values
+const std::size_t PARSE_PHASE_COUNT = 5;
+
+/// \brief Returns parse phase name
+inline const char* get_parse_phase_name(parse_phase phase)
+{
+    switch (phase)
+    {
+    case parse_phase::LEADING_ARGUMENTS:
+        return "leading arguments";
+    case parse_phase::NAMED_ARGUMENTS:
+        return "named arguments";
+    case parse_phase::POSITIONAL_ARGUMENTS:
+        return "positional arguments";
+    case parse_phase::DEFAULT_VALUES:
+        return "default values";
+    case parse_phase::VALUES_COUNT_CHECK:
+        return "values count check";
+    }
+    return "unknown";
+}
+
+/// \brief Parse observer (instrumentation hooks)
+///
+/// Observer receives parsing events with timings, see basic_parse_statistics
+/// for a ready to use implementation. Events are reported only when the
+/// observer is set on the parser (see basic_parser_base::set_parse_observer()).
+///
+/// Phases are reported when they are finished (phases of subparsers are
+/// reported separately, phases are not nested). The observer is called from
+/// the parsing threads, so when the parser is used concurrently (i.e. with
+/// parse_batch()) the observer shall be thread safe.
+///
+/// \tparam char_T              char type (as in std::basic_string)
+template <typename char_T>
+class basic_parse_observer
+{
+public:
+    using char_type = char_T;
+
+    using string_view_type = basic_string_view<char_type>;
+    using argument_handle_type = basic_argument_handle<char_type>;
+
+    using clock_type = std::chrono::steady_clock;
+    using duration_type = clock_type::duration;
+
+    virtual ~basic_parse_observer() = default;
+
+    /// \brief Called when parsing starts (token count is the number of input arguments)
+    virtual void on_parse_begin(std::size_t /*token_count*/)
+    {
+        // noop
+    }
+
+    /// \brief Called when parsing is finished (also when parsing failed)
+    virtual void on_parse_end(bool /*succeeded*/, duration_type /*duration*/)
+    {
+        // noop
+    }
+
+    /// \brief Called when parsing phase is finished
+    virtual void on_phase(parse_phase /*phase*/, duration_type /*duration*/)
+    {
+        // noop
+    }
+
+    /// \brief Called for each argument or subparser name lookup
+    ///
+    /// Input values that cannot be names (rejected by the first char) are not
+    /// looked up.
+    virtual void on_name_lookup(string_view_type /*name*/, bool /*found*/)
+    {
+        // noop
+    }
+
+    /// \brief Called after argument converter call
+    ///
+    /// Not called for default values (they are converted once, when the
+    /// parser is prepared).
+    virtual void on_converter_call(const argument_handle_type& /*argument*/, duration_type /*duration*/)
+    {
+        // noop
+    }
+
+    /// \brief Called after argument handler (check and store functions) call
+    virtual void on_handler_call(const argument_handle_type& /*argument*/, duration_type /*duration*/)
+    {
+        // noop
+    }
+};
+
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_PARSE_OBSERVER_HPP_
@@ -0,0 +1,68 @@
+#ifndef OCTARGS_PARSE_RESULT_HPP_
+#define OCTARGS_PARSE_RESULT_HPP_
+
+#include <memory>
+#include <stdexcept>
+
+#include "parser_error.hpp"
+#include "results.hpp"
+#include "string_view.hpp"
+#include "validation_result.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+/// \brief Result of parsing without exceptions
+///
+/// Contains parsing results on success or error description otherwise (see
+/// parser try_parse() functions). The error description is the same as for
+/// validation (see basic_validation_result).
+///
+/// \tparam char_T              char type (as in std::basic_string)
+template <typename char_T>
+class basic_parse_result : public basic_validation_result<char_T>
+{
+public:
+    using base_type = basic_validation_result<char_T>;
+
+    using char_type = char_T;
+
+    using string_view_type = typename base_type::string_view_type;
+
+    using results_type = basic_results<char_type>;
+
+    explicit basic_parse_result(const results_type& results)
+        : base_type()
+        , m_results(results)
+    {
+        // noop
+    }
+
+    basic_parse_result(parser_error_code error_code, std::size_t error_index, string_view_type error_name,
+        string_view_type error_value, const std::shared_ptr<const void>& keep_alive_ptr)
+        : base_type(error_code, error_index, error_name, error_value, keep_alive_ptr)
+        , m_results(nullptr, nullptr)
+    {
+        // noop
+    }
+
+    /// \brief Returns parsing results (throws std::logic_error if parsing failed)
+    const results_type& get_results() const
+    {
+        if (this->has_error())
+        {
+            throw std::logic_error("parsing failed, results are not available");
+        }
+        return m_results;
+    }
+
+private:
+    results_type m_results;
+};
+
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_PARSE_RESULT_HPP_
@@ -0,0 +1,328 @@
+#ifndef OCTARGS_PARSE_STATISTICS_HPP_
+#define OCTARGS_PARSE_STATISTICS_HPP_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+#include "parse_observer.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+/// \brief Histogram of durations
+///
+/// Durations are counted in buckets growing by powers of two: bucket 0 is
+/// for durations below 1 ns, bucket N for durations in [2^(N-1), 2^N) ns.
+/// The last bucket also counts all the longer durations.
+class duration_histogram
+{
+public:
+    using duration_type = std::chrono::steady_clock::duration;
+
+    static const std::size_t BUCKET_COUNT = 40;
+
+    duration_histogram()
+        : m_count(0)
+        , m_total(duration_type::zero())
+        , m_max(duration_type::zero())
+        , m_buckets()
+    {
+        m_buckets.fill(0);
+    }
+
+    void add(duration_type duration)
+    {
+        ++m_count;
+        m_total += duration;
+        m_max = std::max(m_max, duration);
+        ++m_buckets[get_bucket_index(duration)];
+    }
+
+    std::size_t get_count() const
+    {
+        return m_count;
+    }
+
+    duration_type get_total() const
+    {
+        return m_total;
+    }
+
+    duration_type get_max() const
+    {
+        return m_max;
+    }
+
+    duration_type get_mean() const
+    {
+        return (m_count > 0) ? (m_total / static_cast<duration_type::rep>(m_count)) : duration_type::zero();
+    }
+
+    std::size_t get_bucket_count(std::size_t bucket_index) const
+    {
+        return m_buckets.at(bucket_index);
+    }
+
+    /// \brief Returns upper bound (exclusive) of the bucket in nanoseconds (the last bucket is unbounded)
+    static std::uint64_t get_bucket_limit_ns(std::size_t bucket_index)
+    {
+        return std::uint64_t(1) << bucket_index;
+    }
+
+    static std::size_t get_bucket_index(duration_type duration)
+    {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+
+        std::size_t index = 0;
+        while ((ns > 0) && (index + 1 < BUCKET_COUNT))
+        {
+            ns >>= 1;
+            ++index;
+        }
+        return index;
+    }
+
+private:
+    std::size_t m_count;
+    duration_type m_total;
+    duration_type m_max;
+    std::array<std::size_t, BUCKET_COUNT> m_buckets;
+};
+
+/// \brief Parse observer aggregating parsing statistics
+///
+/// Collects parse, phase and per argument converter and handler durations
+/// histograms, token counts and names lookup hits and misses. Converter and
+/// handler (check and store functions) durations are grouped by the argument
+/// first name with subparser prefix (e.g. "add --verbose", as used by results),
+/// so slow converters or check functions could be found with dump(). All
+/// functions are thread safe.
+///
+/// \tparam char_T              char type (as in std::basic_string)
+template <typename char_T>
+class basic_parse_statistics : public basic_parse_observer<char_T>
+{
+public:
+    using base_type = basic_parse_observer<char_T>;
+
+    using char_type = char_T;
+
+    using string_type = std::basic_string<char_type>;
+    using string_view_type = typename base_type::string_view_type;
+    using argument_handle_type = typename base_type::argument_handle_type;
+    using duration_type = typename base_type::duration_type;
+
+    using ostream_type = std::basic_ostream<char_type>;
+
+    basic_parse_statistics()
+        : m_mutex()
+        , m_failed_count(0)
+        , m_token_count(0)
+        , m_lookup_hit_count(0)
+        , m_lookup_miss_count(0)
+        , m_parse_histogram()
+        , m_phase_histograms()
+        , m_converter_histograms()
+        , m_handler_histograms()
+    {
+        // noop
+    }
+
+    void on_parse_begin(std::size_t token_count) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_token_count += token_count;
+    }
+
+    void on_parse_end(bool succeeded, duration_type duration) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_parse_histogram.add(duration);
+        if (!succeeded)
+        {
+            ++m_failed_count;
+        }
+    }
+
+    void on_phase(parse_phase phase, duration_type duration) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_phase_histograms[static_cast<std::size_t>(phase)].add(duration);
+    }
+
+    void on_name_lookup(string_view_type /*name*/, bool found) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++(found ? m_lookup_hit_count : m_lookup_miss_count);
+    }
+
+    void on_converter_call(const argument_handle_type& argument, duration_type duration) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_converter_histograms[argument.get_qualified_name()].add(duration);
+    }
+
+    void on_handler_call(const argument_handle_type& argument, duration_type duration) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_handler_histograms[argument.get_qualified_name()].add(duration);
+    }
+
+    std::size_t get_parse_count() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_parse_histogram.get_count();
+    }
+
+    std::size_t get_failed_count() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_failed_count;
+    }
+
+    std::size_t get_token_count() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_token_count;
+    }
+
+    std::size_t get_lookup_hit_count() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_lookup_hit_count;
+    }
+
+    std::size_t get_lookup_miss_count() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_lookup_miss_count;
+    }
+
+    duration_histogram get_parse_histogram() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_parse_histogram;
+    }
+
+    duration_histogram get_phase_histogram(parse_phase phase) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_phase_histograms[static_cast<std::size_t>(phase)];
+    }
+
+    /// \brief Returns converter durations histogram of the argument (empty if converter was not called)
+    ///
+    /// Argument is given by first name with subparser prefix (as in results).
+    duration_histogram get_converter_histogram(const string_type& argument_name) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto iter = m_converter_histograms.find(argument_name);
+        return (iter != m_converter_histograms.end()) ? iter->second : duration_histogram();
+    }
+
+    /// \brief Returns handler durations histogram of the argument (empty if handler was not called)
+    ///
+    /// Argument is given by first name with subparser prefix (as in results).
+    duration_histogram get_handler_histogram(const string_type& argument_name) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto iter = m_handler_histograms.find(argument_name);
+        return (iter != m_handler_histograms.end()) ? iter->second : duration_histogram();
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_failed_count = 0;
+        m_token_count = 0;
+        m_lookup_hit_count = 0;
+        m_lookup_miss_count = 0;
+        m_parse_histogram = duration_histogram();
+        m_phase_histograms.fill(duration_histogram());
+        m_converter_histograms.clear();
+        m_handler_histograms.clear();
+    }
+
+    /// \brief Writes the statistics (counters and histograms) in human readable form
+    void dump(ostream_type& os) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        os << "parses: " << m_parse_histogram.get_count() << " (failed: " << m_failed_count << ")\n";
+        os << "tokens: " << m_token_count << "\n";
+        os << "name lookups: " << (m_lookup_hit_count + m_lookup_miss_count) << " (hits: " << m_lookup_hit_count
+           << ", misses: " << m_lookup_miss_count << ")\n";
+
+        dump_histogram(os, "parse", m_parse_histogram);
+        for (std::size_t i = 0; i < PARSE_PHASE_COUNT; ++i)
+        {
+            os << "phase ";
+            dump_histogram(os, get_parse_phase_name(static_cast<parse_phase>(i)), m_phase_histograms[i]);
+        }
+        for (auto& entry : m_converter_histograms)
+        {
+            os << "converter ";
+            dump_histogram(os, entry.first, entry.second);
+        }
+        for (auto& entry : m_handler_histograms)
+        {
+            os << "handler ";
+            dump_histogram(os, entry.first, entry.second);
+        }
+    }
+
+private:
+    template <typename name_T>
+    static void dump_histogram(ostream_type& os, const name_T& name, const duration_histogram& histogram)
+    {
+        using std::chrono::duration_cast;
+        using std::chrono::nanoseconds;
+
+        os << name << ": count " << histogram.get_count() << ", total "
+           << duration_cast<nanoseconds>(histogram.get_total()).count() << " ns, mean "
+           << duration_cast<nanoseconds>(histogram.get_mean()).count() << " ns, max "
+           << duration_cast<nanoseconds>(histogram.get_max()).count() << " ns\n";
+
+        for (std::size_t i = 0; i < duration_histogram::BUCKET_COUNT; ++i)
+        {
+            if (histogram.get_bucket_count(i) == 0)
+            {
+                continue;
+            }
+
+            // the last bucket also counts all the longer durations
+            if (i + 1 < duration_histogram::BUCKET_COUNT)
+            {
+                os << "  < " << duration_histogram::get_bucket_limit_ns(i);
+            }
+            else
+            {
+                os << "  >= " << duration_histogram::get_bucket_limit_ns(i - 1);
+            }
+            os << " ns: " << histogram.get_bucket_count(i) << "\n";
+        }
+    }
+
+    mutable std::mutex m_mutex;
+    std::size_t m_failed_count;
+    std::size_t m_token_count;
+    std::size_t m_lookup_hit_count;
+    std::size_t m_lookup_miss_count;
+    duration_histogram m_parse_histogram;
+    std::array<duration_histogram, PARSE_PHASE_COUNT> m_phase_histograms;
+    std::map<string_type, duration_histogram> m_converter_histograms;
+    std::map<string_type, duration_histogram> m_handler_histograms;
+};
+
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_PARSE_STATISTICS_HPP_
@@ -0,0 +1,109 @@
+#ifndef OCTARGS_PARSE_VISITOR_HPP_
+#define OCTARGS_PARSE_VISITOR_HPP_
+
+#include <string>
+#include <vector>
+
+#include "string_view.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+/// \brief Argument handle passed to parse visitor
+///
+/// Identifies the argument (within the parser and all its subparsers) the
+/// visited value belongs to.
+///
+/// \tparam char_T              char type (as in std::basic_string)
+template <typename char_T>
+class basic_argument_handle
+{
+public:
+    using char_type = char_T;
+
+    using string_type = std::basic_string<char_type>;
+    using string_vector_type = std::vector<string_type>;
+
+    template <typename argument_T>
+    basic_argument_handle(const argument_T& argument, const string_type& qualified_name)
+        : m_id(argument.get_slot())
+        , m_names(argument.get_names())
+        , m_qualified_name(qualified_name)
+    {
+        // noop
+    }
+
+    /// \brief Returns argument identifier (unique in the parsers tree)
+    std::size_t get_id() const
+    {
+        return m_id;
+    }
+
+    /// \brief Returns argument first name (without subparser prefix)
+    const string_type& get_name() const
+    {
+        return m_names[0];
+    }
+
+    /// \brief Returns all argument names (without subparser prefix)
+    const string_vector_type& get_names() const
+    {
+        return m_names;
+    }
+
+    /// \brief Returns argument first name with subparser prefix (as used by results, e.g. "add --verbose")
+    const string_type& get_qualified_name() const
+    {
+        return m_qualified_name;
+    }
+
+private:
+    std::size_t m_id;
+    const string_vector_type& m_names;
+    const string_type& m_qualified_name;
+};
+
+/// \brief Parse visitor
+///
+/// Visitor receives argument values as they are accepted by the parser, in
+/// the command line order. Values are validated (allowed values, maximum
+/// count, conversion) before they are passed to the visitor. Default values
+/// are passed when the parser (or subparser) arguments are completed, and
+/// minimum counts are checked after that, so when parsing fails with an
+/// exception some values may have been already visited.
+///
+/// Parsing with visitor does not store the values, so the used memory does not
+/// depend on the number of values. Visited values are views of the arguments
+/// table contents.
+///
+/// \tparam char_T              char type (as in std::basic_string)
+template <typename char_T>
+class basic_parse_visitor
+{
+public:
+    using char_type = char_T;
+
+    using string_view_type = basic_string_view<char_type>;
+    using argument_handle_type = basic_argument_handle<char_type>;
+
+    /// Index passed for default values (not present in arguments table).
+    static const std::size_t DEFAULT_VALUE_INDEX = static_cast<std::size_t>(-1);
+
+    virtual ~basic_parse_visitor() = default;
+
+    /// \brief Called for each accepted value
+    ///
+    /// The arg_index is the index of the value in arguments table (the
+    /// application name is not included) or DEFAULT_VALUE_INDEX.
+    virtual void on_value(const argument_handle_type& argument, string_view_type value, std::size_t arg_index) = 0;
+};
+
+template <typename char_T>
+const std::size_t basic_parse_visitor<char_T>::DEFAULT_VALUE_INDEX;
+
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_PARSE_VISITOR_HPP_
@@ -7,15 +7,23 @@
 
 #include "argument_group.hpp"
 #include "argument_table.hpp"
+#include "compiled_parser.hpp"
 #include "dictionary.hpp"
 #include "exception.hpp"
 #include "names.hpp"
+#include "parse_api.hpp"
+#include "parse_context.hpp"
+#include "parse_observer.hpp"
+#include "parse_result.hpp"
+#include "parse_visitor.hpp"
 #include "parser_error.hpp"
 #include "results.hpp"
+#include "validation_result.hpp"
 #include "usage.hpp"
 
 #include "internal/argument.hpp"
-#include "internal/parser_engine.hpp"
+#include "internal/parser_snapshot.hpp"
+#include "internal/snapshot_source.hpp"
 
 namespace oct
 {
@@ -24,11 +32,23 @@ namespace args
 
 /// \brief Arguments parser base
 ///
+/// Thread safety: once the parser is fully defined, parse() (and compile())
+/// could be called concurrently from multiple threads on the same parser
+/// instance. All per-call state is kept by the parse call itself. Modifying
+/// the parser definition concurrently with parsing is not allowed. Argument
+/// handlers (converters, checkers, storing functions) are invoked from the
+/// calling thread, so when values storage is used each thread shall pass its
+/// own storage object and custom handlers shall be thread safe.
+///
+/// Parse functions are provided by basic_parse_api (same as in compiled
+/// parsers), they use the snapshot of the current parser definition.
+///
 /// \tparam derived_T           derived (parser) type
 /// \tparam char_T              char type (as in std::basic_string)
 /// \tparam values_storage_T    type of class uses as a storage for parsed values
 template <typename derived_T, typename char_T, typename values_storage_T>
 class basic_parser_base
+    : public basic_parse_api<char_T, values_storage_T, internal::parser_data_snapshot_source<char_T, values_storage_T>>
 {
 public:
     using derived_type = derived_T;
@@ -53,8 +73,24 @@ public:
     using argument_table_type = basic_argument_table<char_type>;
     using results_type = basic_results<char_type>;
 
+    using parse_context_type = basic_parse_context<char_type>;
+
+    using parse_visitor_type = basic_parse_visitor<char_type>;
+
+    using parse_observer_type = basic_parse_observer<char_type>;
+    using parse_observer_ptr_type = std::shared_ptr<parse_observer_type>;
+
+    using parse_result_type = basic_parse_result<char_type>;
+
+    using validation_result_type = basic_validation_result<char_type>;
+
     using parser_usage_type = basic_parser_usage<char_type, values_storage_type>;
 
+    using compiled_parser_type = basic_compiled_parser<char_type, values_storage_type>;
+
+    using parse_api_type = basic_parse_api<char_type, values_storage_type,
+        internal::parser_data_snapshot_source<char_type, values_storage_type>>;
+
     parser_usage_type get_usage() const
     {
         return parser_usage_type(m_data_ptr);
@@ -78,6 +114,19 @@ public:
         return cast_this_to_derived();
     }
 
+    /// \brief Sets parse observer (null to remove it)
+    ///
+    /// Observer receives parsing events with timings (see basic_parse_observer
+    /// and basic_parse_statistics). It is used only when set on the parser
+    /// the parse function is called on. Without observer the parsing does not
+    /// read clocks (instrumentation points cost a null check).
+    derived_type& set_parse_observer(const parse_observer_ptr_type& observer)
+    {
+        m_data_ptr->m_parse_observer = observer;
+        m_data_ptr->m_tree_state->mark_modified();
+        return cast_this_to_derived();
+    }
+
     argument_group_type add_group(const std::string& name)
     {
         return m_data_ptr->add_group(name);
@@ -108,17 +157,30 @@ public:
         return subparser_argument_type(m_data_ptr->add_subparsers(name));
     }
 
+    /// \brief Compiles the parser
+    ///
+    /// Returns parser working on an immutable snapshot of the current parser
+    /// definition (including subparsers). Compiled parser could be used when
+    /// the same definition is used to parse many command lines. Default values
+    /// are validated and converted here (invalid_default_value is thrown if
+    /// they are not valid).
+    compiled_parser_type compile() const
+    {
+        return compiled_parser_type(snapshot_type::get(*m_data_ptr));
+    }
+
 protected:
     using parser_data_type = internal::basic_parser_data<char_type, values_storage_type>;
     using parser_data_ptr_type = std::shared_ptr<parser_data_type>;
     using const_parser_data_ptr_type = std::shared_ptr<const parser_data_type>;
 
-    using storage_helper_type = internal::storage_handler_helper<char_type, values_storage_type>;
+    using snapshot_source_type = internal::parser_data_snapshot_source<char_type, values_storage_type>;
 
-    using engine_type = internal::basic_parser_engine<char_type, values_storage_type>;
+    using snapshot_type = internal::basic_parser_snapshot<char_type, values_storage_type>;
 
     explicit basic_parser_base(parser_data_ptr_type data_ptr)
-        : m_data_ptr(data_ptr)
+        : parse_api_type(snapshot_source_type(data_ptr))
+        , m_data_ptr(data_ptr)
     {
         // noop
     }
@@ -128,12 +190,6 @@ protected:
         return static_cast<derived_T&>(*this);
     }
 
-    results_type parse_internal(const argument_table_type& arg_table, storage_helper_type& storage_helper) const
-    {
-        engine_type engine(arg_table, storage_helper, m_data_ptr);
-        return engine.parse();
-    }
-
 private:
     parser_data_ptr_type m_data_ptr;
 };
@@ -154,10 +210,6 @@ public:
     using dictionary_type = dictionary<char_type>;
     using const_dictionary_ptr_type = std::shared_ptr<const dictionary_type>;
 
-    using argument_table_type = basic_argument_table<char_type>;
-
-    using results_type = basic_results<char_type>;
-
     using parser_data_type = typename base_type::parser_data_type;
     using parser_data_ptr_type = typename base_type::parser_data_ptr_type;
 
@@ -178,28 +230,6 @@ public:
     {
         // noop
     }
-
-    results_type parse(int argc, char_type* argv[], values_storage_type& values_storage) const
-    {
-        return this->parse_internal(argument_table_type(argc, argv), values_storage);
-    }
-
-    results_type parse(int argc, const char_type* argv[], values_storage_type& values_storage) const
-    {
-        return this->parse_internal(argument_table_type(argc, argv), values_storage);
-    }
-
-    results_type parse(const argument_table_type& arg_table, values_storage_type& values_storage) const
-    {
-        return this->parse_internal(arg_table, values_storage);
-    }
-
-private:
-    results_type parse_internal(const argument_table_type& arg_table, values_storage_type& values_storage) const
-    {
-        typename base_type::storage_helper_type helper(values_storage);
-        return base_type::parse_internal(arg_table, helper);
-    }
 };
 
 /// \brief Arguments parser
@@ -217,10 +247,6 @@ public:
     using dictionary_type = dictionary<char_type>;
     using const_dictionary_ptr_type = std::shared_ptr<const dictionary_type>;
 
-    using argument_table_type = basic_argument_table<char_type>;
-
-    using results_type = basic_results<char_type>;
-
     using parser_data_type = typename base_type::parser_data_type;
     using parser_data_ptr_type = typename base_type::parser_data_ptr_type;
 
@@ -241,28 +267,6 @@ public:
     {
         // noop
     }
-
-    results_type parse(int argc, char_type* argv[]) const
-    {
-        return this->parse_internal(argument_table_type(argc, argv));
-    }
-
-    results_type parse(int argc, const char_type* argv[]) const
-    {
-        return this->parse_internal(argument_table_type(argc, argv));
-    }
-
-    results_type parse(const argument_table_type& arg_table) const
-    {
-        return this->parse_internal(arg_table);
-    }
-
-private:
-    results_type parse_internal(const argument_table_type& arg_table) const
-    {
-        typename base_type::storage_helper_type helper;
-        return base_type::parse_internal(arg_table, helper);
-    }
 };
 
 } // namespace args
@@ -88,6 +88,18 @@ public:
         this->get_argument().set_max_count_unlimited();
         return this->cast_this_to_derived();
     }
+
+    /// \brief Sets if values are stored as a range of the arguments table
+    ///
+    /// In this mode all values the argument accepts are taken at once and
+    /// validated in one pass. Results reference the slice of the arguments
+    /// table instead of storing each value (see basic_results::get_values_range()),
+    /// values converted by argument type handler are not kept.
+    basic_positional_argument& set_values_as_range(bool enabled = true)
+    {
+        this->get_argument().set_values_as_range(enabled);
+        return this->cast_this_to_derived();
+    }
 };
 
 } // namespace args
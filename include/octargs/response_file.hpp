@@ -0,0 +1,43 @@
+#ifndef OCTARGS_RESPONSE_FILE_HPP_
+#define OCTARGS_RESPONSE_FILE_HPP_
+
+#include <cstddef>
+
+#include "argument_table.hpp"
+
+#include "internal/response_files_expander.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+/// \brief Default maximum nesting depth of response files
+const std::size_t DEFAULT_RESPONSE_FILES_MAX_DEPTH = 16;
+
+/// \brief Expands response files
+///
+/// Each argument in form \@path is replaced by the arguments read from
+/// the file at given path. The file contains arguments separated by NUL
+/// characters (if the file contains any NUL character) or one argument
+/// per line. Empty arguments are skipped. Response files could be nested
+/// up to the given depth, a file including itself is reported as error.
+///
+/// Files are memory mapped (where supported) and owned by the table,
+/// the arguments are views pointing to the file contents (no copies).
+///
+/// This header is not included by octargs.hpp, as it depends on platform
+/// file APIs (POSIX headers where available).
+///
+/// Available for char tables only.
+template <typename char_T>
+void expand_response_files(
+    basic_argument_table<char_T>& table, std::size_t max_depth = DEFAULT_RESPONSE_FILES_MAX_DEPTH)
+{
+    internal::response_files_expander<char_T>(table).expand(max_depth);
+}
+
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_RESPONSE_FILE_HPP_
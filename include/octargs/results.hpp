@@ -4,9 +4,13 @@
 #include <memory>
 
 #include "argument_table.hpp"
+#include "converter.hpp"
+#include "string_view.hpp"
+#include "values_range.hpp"
 #include "internal/argument.hpp"
 #include "internal/function_helpers.hpp"
 #include "internal/results_data.hpp"
+#include "internal/typed_value.hpp"
 
 namespace oct
 {
@@ -24,6 +28,10 @@ public:
 
     using string_type = std::basic_string<char_type>;
     using string_vector_type = std::vector<string_type>;
+    using string_view_type = basic_string_view<char_type>;
+    using string_view_vector_type = std::vector<string_view_type>;
+
+    using values_range_type = basic_values_range<char_type>;
 
     using argument_table_type = basic_argument_table<char_type>;
 
@@ -80,6 +88,31 @@ public:
         return m_results_data_ptr->get_values(arg_name);
     }
 
+    /// \brief Returns argument values as views
+    ///
+    /// Views do not copy the values. Values taken from argument table created
+    /// from argc + argv are valid only as long as the argv strings are alive.
+    const string_view_vector_type& get_value_views(const string_type& arg_name) const
+    {
+        return m_results_data_ptr->get_value_views(arg_name);
+    }
+
+    /// \brief Returns argument values as a range of views
+    ///
+    /// Does not copy the values (also for positional arguments storing values
+    /// as range of the arguments table, see
+    /// basic_positional_argument::set_values_as_range()).
+    values_range_type get_values_range(const string_type& arg_name) const
+    {
+        auto range = m_results_data_ptr->get_value_range(arg_name);
+        return values_range_type(range.first, range.second, m_results_data_ptr);
+    }
+
+    /// \brief Returns first argument value converted to given type
+    ///
+    /// If the value was already converted during parsing (argument type is
+    /// data_T and the argument uses stateless converter of type converter_T)
+    /// the converted value is returned without repeating the conversion.
     template <typename data_T, typename converter_T = basic_converter<char_type, data_T>>
     data_T get_first_value_as(const string_type& arg_name) const
     {
@@ -87,9 +120,13 @@ public:
         using converter_type = converter_T;
         using helper = internal::convert_function_helper<char_type, data_type>;
 
-        auto& value = get_first_value(arg_name);
-        auto convert_func = helper::prepare(converter_type());
-        return convert_func(*m_dictionary_ptr, value);
+        auto converted_value_ptr = find_first_converted_value<data_type, converter_type>(arg_name);
+        if (converted_value_ptr)
+        {
+            return *converted_value_ptr;
+        }
+
+        return helper::invoke(converter_type(), *m_dictionary_ptr, get_first_value(arg_name));
     }
 
     template <typename data_T, typename converter_T = basic_converter<char_type, data_T>>
@@ -99,6 +136,12 @@ public:
         using converter_type = converter_T;
         using helper = internal::convert_function_helper<char_type, data_type>;
 
+        auto converted_value_ptr = find_first_converted_value<data_type, converter_type>(arg_name);
+        if (converted_value_ptr)
+        {
+            return *converted_value_ptr;
+        }
+
         auto& values = get_values(arg_name);
         if (values.size() == 0)
         {
@@ -106,12 +149,13 @@ public:
         }
         else
         {
-            auto& value = values[0];
-            auto convert_func = helper::prepare(converter_type());
-            return convert_func(*m_dictionary_ptr, value);
+            return helper::invoke(converter_type(), *m_dictionary_ptr, values[0]);
         }
     }
 
+    /// \brief Returns argument values converted to given type
+    ///
+    /// Values already converted during parsing are reused (see get_first_value_as()).
     template <typename data_T, typename converter_T = basic_converter<char_type, data_T>>
     std::vector<data_T> get_values_as(const string_type& arg_name) const
     {
@@ -121,17 +165,49 @@ public:
 
         std::vector<data_type> data_vector;
 
-        auto convert_func = helper::prepare(converter_type());
+        auto converted_values_ptr = find_converted_values<data_type, converter_type>(arg_name);
+        if (converted_values_ptr)
+        {
+            data_vector.reserve(converted_values_ptr->size());
+            for (const auto& converted_value : *converted_values_ptr)
+            {
+                data_vector.emplace_back(*converted_value.template get<data_type>());
+            }
+            return data_vector;
+        }
+
+        converter_type converter;
 
         for (const auto& value_str : get_values(arg_name))
         {
-            data_vector.emplace_back(convert_func(*m_dictionary_ptr, value_str));
+            data_vector.emplace_back(helper::invoke(converter, *m_dictionary_ptr, value_str));
         }
 
         return data_vector;
     }
 
 private:
+    using typed_value_vector_type = typename results_data_type::typed_value_vector_type;
+
+    template <typename data_T, typename converter_T>
+    const typed_value_vector_type* find_converted_values(const string_type& arg_name) const
+    {
+        auto converted_values_ptr
+            = m_results_data_ptr->find_converted_values(arg_name, internal::get_type_id<converter_T>());
+        if (!converted_values_ptr || !converted_values_ptr->front().template get<data_T>())
+        {
+            return nullptr;
+        }
+        return converted_values_ptr;
+    }
+
+    template <typename data_T, typename converter_T>
+    const data_T* find_first_converted_value(const string_type& arg_name) const
+    {
+        auto converted_values_ptr = find_converted_values<data_T, converter_T>(arg_name);
+        return converted_values_ptr ? converted_values_ptr->front().template get<data_T>() : nullptr;
+    }
+
     const_dictionary_ptr_type m_dictionary_ptr;
     const_results_data_ptr_type m_results_data_ptr;
 };
@@ -0,0 +1,165 @@
+#ifndef OCTARGS_STRING_VIEW_HPP_
+#define OCTARGS_STRING_VIEW_HPP_
+
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+namespace oct
+{
+namespace args
+{
+
+/// \brief Non-owning reference to a sequence of characters
+///
+/// Minimal replacement of the C++17 std::basic_string_view usable with C++11.
+/// The view does not own the referenced characters - it is valid as long as
+/// the referenced sequence is alive and not modified.
+///
+/// \tparam char_T      char type (as in std::basic_string)
+template <typename char_T>
+class basic_string_view
+{
+public:
+    using char_type = char_T;
+
+    using string_type = std::basic_string<char_type>;
+    using traits_type = typename string_type::traits_type;
+
+    using const_iterator = const char_type*;
+
+    static const std::size_t npos = static_cast<std::size_t>(-1);
+
+    basic_string_view()
+        : m_data(nullptr)
+        , m_size(0)
+    {
+        // noop
+    }
+
+    basic_string_view(const char_type* data, std::size_t size)
+        : m_data(data)
+        , m_size(size)
+    {
+        // noop
+    }
+
+    basic_string_view(const char_type* str)
+        : m_data(str)
+        , m_size(traits_type::length(str))
+    {
+        // noop
+    }
+
+    basic_string_view(const string_type& str)
+        : m_data(str.data())
+        , m_size(str.size())
+    {
+        // noop
+    }
+
+    const char_type* data() const
+    {
+        return m_data;
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    const_iterator begin() const
+    {
+        return m_data;
+    }
+
+    const_iterator end() const
+    {
+        return m_data + m_size;
+    }
+
+    const char_type& operator[](std::size_t pos) const
+    {
+        return m_data[pos];
+    }
+
+    basic_string_view substr(std::size_t pos, std::size_t count = npos) const
+    {
+        if (pos > m_size)
+        {
+            throw std::out_of_range("Position out of range");
+        }
+        return basic_string_view(m_data + pos, std::min(count, m_size - pos));
+    }
+
+    std::size_t find(const basic_string_view& str, std::size_t pos = 0) const
+    {
+        if ((pos > m_size) || (str.m_size > m_size - pos))
+        {
+            return npos;
+        }
+
+        auto last = m_size - str.m_size;
+        for (; pos <= last; ++pos)
+        {
+            if (traits_type::compare(m_data + pos, str.m_data, str.m_size) == 0)
+            {
+                return pos;
+            }
+        }
+        return npos;
+    }
+
+    int compare(const basic_string_view& str) const
+    {
+        auto result = traits_type::compare(m_data, str.m_data, std::min(m_size, str.m_size));
+        if (result != 0)
+        {
+            return result;
+        }
+        return (m_size < str.m_size) ? -1 : ((m_size > str.m_size) ? 1 : 0);
+    }
+
+    string_type to_string() const
+    {
+        return string_type(m_data, m_size);
+    }
+
+    friend bool operator==(const basic_string_view& str1, const basic_string_view& str2)
+    {
+        return (str1.m_size == str2.m_size) && (str1.compare(str2) == 0);
+    }
+
+    friend bool operator!=(const basic_string_view& str1, const basic_string_view& str2)
+    {
+        return !(str1 == str2);
+    }
+
+    friend bool operator<(const basic_string_view& str1, const basic_string_view& str2)
+    {
+        return str1.compare(str2) < 0;
+    }
+
+    friend std::basic_ostream<char_type>& operator<<(std::basic_ostream<char_type>& os, const basic_string_view& str)
+    {
+        return os.write(str.m_data, static_cast<std::streamsize>(str.m_size));
+    }
+
+private:
+    const char_type* m_data;
+    std::size_t m_size;
+};
+
+template <typename char_T>
+const std::size_t basic_string_view<char_T>::npos;
+
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_STRING_VIEW_HPP_
@@ -0,0 +1,103 @@
+#ifndef OCTARGS_VALIDATION_RESULT_HPP_
+#define OCTARGS_VALIDATION_RESULT_HPP_
+
+#include <memory>
+
+#include "parser_error.hpp"
+#include "string_view.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+/// \brief Result of arguments validation
+///
+/// Contains only the error description (see parser validate() functions),
+/// it is also the error part of basic_parse_result. Error name and value are
+/// views of the parser definition (kept alive by the result) or of the
+/// arguments table contents (valid as long as the table values are alive).
+///
+/// \tparam char_T              char type (as in std::basic_string)
+template <typename char_T>
+class basic_validation_result
+{
+public:
+    using char_type = char_T;
+
+    using string_view_type = basic_string_view<char_type>;
+
+    /// Error index used when the error does not refer to any argument in table.
+    static const std::size_t NO_INDEX = static_cast<std::size_t>(-1);
+
+    basic_validation_result()
+        : m_has_error(false)
+        , m_error_code()
+        , m_error_index(NO_INDEX)
+        , m_error_name()
+        , m_error_value()
+        , m_keep_alive_ptr()
+    {
+        // noop
+    }
+
+    basic_validation_result(parser_error_code error_code, std::size_t error_index, string_view_type error_name,
+        string_view_type error_value, const std::shared_ptr<const void>& keep_alive_ptr)
+        : m_has_error(true)
+        , m_error_code(error_code)
+        , m_error_index(error_index)
+        , m_error_name(error_name)
+        , m_error_value(error_value)
+        , m_keep_alive_ptr(keep_alive_ptr)
+    {
+        // noop
+    }
+
+    /// \brief Returns true if arguments are valid
+    explicit operator bool() const
+    {
+        return !m_has_error;
+    }
+
+    bool has_error() const
+    {
+        return m_has_error;
+    }
+
+    parser_error_code get_error_code() const
+    {
+        return m_error_code;
+    }
+
+    /// \brief Returns index of the argument (in arguments table) that caused the error or NO_INDEX
+    std::size_t get_error_index() const
+    {
+        return m_error_index;
+    }
+
+    string_view_type get_error_name() const
+    {
+        return m_error_name;
+    }
+
+    string_view_type get_error_value() const
+    {
+        return m_error_value;
+    }
+
+private:
+    bool m_has_error;
+    parser_error_code m_error_code;
+    std::size_t m_error_index;
+    string_view_type m_error_name;
+    string_view_type m_error_value;
+    std::shared_ptr<const void> m_keep_alive_ptr;
+};
+
+template <typename char_T>
+const std::size_t basic_validation_result<char_T>::NO_INDEX;
+
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_VALIDATION_RESULT_HPP_
@@ -0,0 +1,95 @@
+#ifndef OCTARGS_VALUES_RANGE_HPP_
+#define OCTARGS_VALUES_RANGE_HPP_
+
+#include <memory>
+#include <stdexcept>
+
+#include "string_view.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+/// \brief Range of argument values
+///
+/// Lightweight iterable range of value views. The range keeps the parsing
+/// results it was taken from alive, so it could be copied and used after the
+/// results object is destroyed. As with other views, values taken from
+/// argument table created from argc + argv are valid only as long as the argv
+/// strings are alive.
+///
+/// \tparam char_T              char type (as in std::basic_string)
+template <typename char_T>
+class basic_values_range
+{
+public:
+    using char_type = char_T;
+
+    using string_view_type = basic_string_view<char_type>;
+
+    using value_type = string_view_type;
+    using const_iterator = const string_view_type*;
+    using iterator = const_iterator;
+    using size_type = std::size_t;
+
+    basic_values_range()
+        : m_begin(nullptr)
+        , m_end(nullptr)
+        , m_owner_ptr()
+    {
+        // noop
+    }
+
+    basic_values_range(const_iterator first, const_iterator last, const std::shared_ptr<const void>& owner_ptr)
+        : m_begin(first)
+        , m_end(last)
+        , m_owner_ptr(owner_ptr)
+    {
+        // noop
+    }
+
+    const_iterator begin() const
+    {
+        return m_begin;
+    }
+
+    const_iterator end() const
+    {
+        return m_end;
+    }
+
+    size_type size() const
+    {
+        return static_cast<size_type>(m_end - m_begin);
+    }
+
+    bool empty() const
+    {
+        return m_begin == m_end;
+    }
+
+    const string_view_type& operator[](size_type index) const
+    {
+        return m_begin[index];
+    }
+
+    const string_view_type& at(size_type index) const
+    {
+        if (index >= size())
+        {
+            throw std::out_of_range("values range index out of range");
+        }
+        return m_begin[index];
+    }
+
+private:
+    const_iterator m_begin;
+    const_iterator m_end;
+    std::shared_ptr<const void> m_owner_ptr;
+};
+
+} // namespace args
+} // namespace oct
+
+#endif // OCTARGS_VALUES_RANGE_HPP_
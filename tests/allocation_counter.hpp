@@ -0,0 +1,181 @@
+#ifndef OCTARGS_TESTS_ALLOCATION_COUNTER_HPP
+#define OCTARGS_TESTS_ALLOCATION_COUNTER_HPP
+
+// Replaces all the replaceable global allocation and deallocation functions
+// with versions counting allocations (g_allocation_count). Definitions are
+// not inline, so the header must be included by one source file of a test
+// executable only.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+std::atomic<std::size_t> g_allocation_count(0);
+
+void* counted_allocate(std::size_t size) noexcept
+{
+    ++g_allocation_count;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* counted_allocate_or_throw(std::size_t size)
+{
+    if (void* ptr = counted_allocate(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void counted_deallocate(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+#ifdef __cpp_aligned_new
+
+void* counted_allocate(std::size_t size, std::align_val_t alignment) noexcept
+{
+    ++g_allocation_count;
+
+    auto align = static_cast<std::size_t>(alignment);
+    // size must be a multiple of alignment (aligned_alloc requirement)
+    auto aligned_size = ((size == 0 ? 1 : size) + align - 1) / align * align;
+#ifdef _WIN32
+    return _aligned_malloc(aligned_size, align);
+#else
+    return std::aligned_alloc(align, aligned_size);
+#endif
+}
+
+void* counted_allocate_or_throw(std::size_t size, std::align_val_t alignment)
+{
+    if (void* ptr = counted_allocate(size, alignment))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void counted_deallocate(void* ptr, std::align_val_t /*alignment*/) noexcept
+{
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+#endif // __cpp_aligned_new
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    return counted_allocate_or_throw(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return counted_allocate_or_throw(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    counted_deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    counted_deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    counted_deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    counted_deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    counted_deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    counted_deallocate(ptr);
+}
+
+#ifdef __cpp_aligned_new
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return counted_allocate_or_throw(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return counted_allocate_or_throw(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return counted_allocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return counted_allocate(size, alignment);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept
+{
+    counted_deallocate(ptr, alignment);
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept
+{
+    counted_deallocate(ptr, alignment);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    counted_deallocate(ptr, alignment);
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    counted_deallocate(ptr, alignment);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept
+{
+    counted_deallocate(ptr, alignment);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept
+{
+    counted_deallocate(ptr, alignment);
+}
+
+#endif // __cpp_aligned_new
+
+#endif // OCTARGS_TESTS_ALLOCATION_COUNTER_HPP
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 
 #include <array>
+#include <memory>
 
 #include "../include/octargs/argument_table.hpp"
 
@@ -46,6 +47,47 @@ TEST(argument_table_test, test_string_version)
     ASSERT_EQ(std::string("arg3"), args.get_argument(2));
 }
 
+TEST(argument_table_test, test_argc_argv_borrowed)
+{
+    char app[] { "app" };
+    char arg1[] { "arg1" };
+    char* argv[] = { app, arg1, nullptr };
+    argument_table args(borrow_arguments, 2, argv);
+
+    ASSERT_EQ(arg1, args.get_argument_view(0).data());
+    ASSERT_TRUE(!args.get_storage());
+}
+
+TEST(argument_table_test, test_argc_argv_copied)
+{
+    std::unique_ptr<argument_table> args;
+    {
+        std::string app("app");
+        std::string arg1("argument_value_not_fitting_in_sso");
+        const char* argv[] = { app.c_str(), arg1.c_str(), nullptr };
+        args.reset(new argument_table(2, argv));
+
+        ASSERT_NE(arg1.c_str(), args->get_argument(0).data());
+        ASSERT_TRUE(args->get_storage() != nullptr);
+    }
+
+    ASSERT_EQ(std::string("app"), args->get_app_name());
+    ASSERT_EQ(std::string("argument_value_not_fitting_in_sso"), args->get_argument(0));
+}
+
+TEST(argument_table_test, test_string_owned)
+{
+    std::unique_ptr<argument_table> original(new argument_table("app", { "arg1", "arg2" }));
+    ASSERT_TRUE(original->get_storage() != nullptr);
+
+    argument_table copy(*original);
+    original.reset();
+
+    ASSERT_EQ(std::size_t(2), copy.get_argument_count());
+    ASSERT_EQ(std::string("arg1"), copy.get_argument(0));
+    ASSERT_EQ(std::string("arg2"), copy.get_argument(1));
+}
+
 TEST(argument_table_test, test_iterator)
 {
     argument_table args("app", { "arg1", "arg2" });
@@ -64,5 +106,17 @@ TEST(argument_table_test, test_iterator)
     ASSERT_TRUE(!iter.has_more());
 }
 
+TEST(argument_table_test, test_iterator_views)
+{
+    argument_table args("app", { "arg1", "arg2" });
+
+    argument_table_iterator iter(args);
+    ASSERT_EQ(args.get_argument_view(0).data(), iter.peek_next_view().data());
+    ASSERT_EQ(std::string("arg1"), iter.take_next_view().to_string());
+    ASSERT_EQ(args.get_argument_view(1).data(), iter.take_next_view().data());
+    ASSERT_THROW(iter.peek_next_view(), std::out_of_range);
+    ASSERT_THROW(iter.take_next_view(), std::out_of_range);
+}
+
 } // namespace args
 } // namespace oct
@@ -35,7 +35,7 @@ TEST(argument_test, test_single_name)
     auto data_ptr = std::weak_ptr<parser_data_type>();
 
     string_vector_type names = { "a" };
-    switch_argument_type arg(data_ptr, names);
+    switch_argument_type arg(data_ptr, 0, names);
     ASSERT_EQ(std::size_t(0), arg.get_min_count());
     ASSERT_EQ(std::size_t(1), arg.get_max_count());
     ASSERT_EQ(names.size(), arg.get_names().size());
@@ -50,7 +50,7 @@ TEST(argument_test, test_multi_name)
     auto data_ptr = std::weak_ptr<parser_data_type>();
 
     string_vector_type names = { "a", "bbb", "cc" };
-    switch_argument_type arg(data_ptr, names);
+    switch_argument_type arg(data_ptr, 0, names);
     ASSERT_EQ(std::size_t(0), arg.get_min_count());
     ASSERT_EQ(std::size_t(1), arg.get_max_count());
     ASSERT_EQ(names.size(), arg.get_names().size());
@@ -66,7 +66,7 @@ TEST(argument_test, test_switch_type)
 
     string_vector_type names = { "a" };
 
-    switch_argument_type arg1(data_ptr, names);
+    switch_argument_type arg1(data_ptr, 0, names);
     ASSERT_EQ(false, arg1.is_exclusive());
     ASSERT_EQ(true, arg1.is_assignable_by_name());
     ASSERT_EQ(false, arg1.is_accepting_immediate_value());
@@ -81,7 +81,7 @@ TEST(argument_test, test_exclusive_type)
 
     string_vector_type names = { "a" };
 
-    exclusive_argument_type arg1(data_ptr, names);
+    exclusive_argument_type arg1(data_ptr, 0, names);
     ASSERT_EQ(true, arg1.is_exclusive());
     ASSERT_EQ(true, arg1.is_assignable_by_name());
     ASSERT_EQ(false, arg1.is_accepting_immediate_value());
@@ -96,7 +96,7 @@ TEST(argument_test, test_valued_type)
 
     string_vector_type names = { "a" };
 
-    valued_argument_type arg1(data_ptr, names);
+    valued_argument_type arg1(data_ptr, 0, names);
     ASSERT_EQ(false, arg1.is_exclusive());
     ASSERT_EQ(true, arg1.is_assignable_by_name());
     ASSERT_EQ(true, arg1.is_accepting_immediate_value());
@@ -111,7 +111,7 @@ TEST(argument_test, test_positional_type)
 
     string_vector_type names = { "a" };
 
-    positional_argument_type arg1(data_ptr, names);
+    positional_argument_type arg1(data_ptr, 0, names);
     ASSERT_EQ(false, arg1.is_exclusive());
     ASSERT_EQ(false, arg1.is_assignable_by_name());
     ASSERT_EQ(false, arg1.is_accepting_immediate_value());
@@ -120,7 +120,7 @@ TEST(argument_test, test_positional_type)
     ASSERT_EQ(std::size_t(1), arg1.get_max_count());
     ASSERT_EQ(static_cast<std::size_t>(1), arg1.get_max_count());
 
-    positional_argument_type arg2(data_ptr, names);
+    positional_argument_type arg2(data_ptr, 0, names);
     arg2.set_min_count(3);
     arg2.set_max_count(10);
     ASSERT_EQ(false, arg2.is_assignable_by_name());
@@ -132,5 +132,27 @@ TEST(argument_test, test_positional_type)
     ASSERT_TRUE(arg2.is_max_count_unlimited());
 }
 
+TEST(argument_test, test_slots)
+{
+    auto data_ptr = parser_data_type::create(std::make_shared<dictionary_type>());
+
+    auto arg1 = data_ptr->add_switch({ "-a" });
+    auto arg2 = data_ptr->add_valued({ "-b", "--bbb" });
+    auto subparsers = data_ptr->add_subparsers("command");
+    auto subparser_data_ptr = data_ptr->add_subparser("sub");
+    auto arg3 = subparser_data_ptr->add_switch({ "-a" });
+    auto arg4 = subparser_data_ptr->add_positional("files");
+    auto arg5 = data_ptr->add_exclusive({ "--help" });
+
+    ASSERT_EQ(std::size_t(0), arg1->get_slot());
+    ASSERT_EQ(std::size_t(1), arg2->get_slot());
+    ASSERT_EQ(std::size_t(2), subparsers->get_slot());
+    ASSERT_EQ(std::size_t(3), arg3->get_slot());
+    ASSERT_EQ(std::size_t(4), arg4->get_slot());
+    ASSERT_EQ(std::size_t(5), arg5->get_slot());
+    ASSERT_EQ(std::size_t(6), data_ptr->m_tree_state->get_slot_count());
+    ASSERT_EQ(data_ptr->m_tree_state, subparser_data_ptr->m_tree_state);
+}
+
 } // namespace args
 } // namespace oct
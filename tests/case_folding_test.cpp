@@ -0,0 +1,76 @@
+#include "gtest/gtest.h"
+
+#include <string>
+
+#include "../include/octargs/internal/case_folding.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+namespace
+{
+
+template <typename char_T>
+std::basic_string<char_T> fold(const std::basic_string<char_T>& str)
+{
+    std::basic_string<char_T> folded(str.size(), char_T());
+    internal::fold_case_copy(str.data(), str.size(), &folded[0]);
+    return folded;
+}
+
+template <typename char_T>
+bool equal(const std::basic_string<char_T>& str1, const std::basic_string<char_T>& str2)
+{
+    return (str1.size() == str2.size()) && internal::equal_ignore_case(str1.data(), str2.data(), str1.size());
+}
+
+} // namespace
+
+TEST(case_folding_test, test_fold_case_char)
+{
+    ASSERT_TRUE(internal::fold_case('a') == 'a');
+    ASSERT_TRUE(internal::fold_case('A') == 'a');
+    ASSERT_TRUE(internal::fold_case('Z') == 'z');
+    ASSERT_TRUE(internal::fold_case('@') == '@');
+    ASSERT_TRUE(internal::fold_case('[') == '[');
+    ASSERT_TRUE(internal::fold_case(L'Q') == L'q');
+    ASSERT_TRUE(internal::fold_case(L'-') == L'-');
+}
+
+TEST(case_folding_test, test_fold_case_copy)
+{
+    ASSERT_EQ(std::string(""), fold(std::string("")));
+    ASSERT_EQ(std::string("--name"), fold(std::string("--NaMe")));
+    ASSERT_EQ(std::string("--a-very-long-option-name-with-digits-0123456789@[]"),
+        fold(std::string("--A-Very-Long-OPTION-name-with-DIGITS-0123456789@[]")));
+
+    // non-ASCII chars are kept (C locale), ASCII chars in the same block are folded
+    ASSERT_EQ(std::string("--non-ascii-\xC3\x89-block-abc"), fold(std::string("--NON-ASCII-\xC3\x89-BLOCK-ABC")));
+
+    ASSERT_EQ(std::wstring(L"--wide-name-abcdefghijklmnop"), fold(std::wstring(L"--Wide-NAME-ABCDEFGHIJKLMNOP")));
+}
+
+TEST(case_folding_test, test_equal_ignore_case)
+{
+    ASSERT_TRUE(equal(std::string(""), std::string("")));
+    ASSERT_TRUE(equal(std::string("Value"), std::string("vALUE")));
+    ASSERT_FALSE(equal(std::string("Value"), std::string("Valve")));
+    ASSERT_FALSE(equal(std::string("@"), std::string("`")));
+    ASSERT_FALSE(equal(std::string("["), std::string("{")));
+
+    std::string long_value("A-Long-Value-Longer-Than-One-Block");
+    ASSERT_TRUE(equal(long_value, std::string("a-long-VALUE-longer-than-one-BLOCK")));
+    ASSERT_FALSE(equal(long_value, std::string("a-long-VALUE-longer-than-one-BLOCx")));
+    ASSERT_FALSE(equal(long_value, std::string("b-long-VALUE-longer-than-one-BLOCK")));
+
+    ASSERT_TRUE(equal(std::string("\xC3\x89-non-ascii-block-Value"), std::string("\xC3\x89-NON-ASCII-BLOCK-vALUE")));
+    ASSERT_FALSE(equal(std::string("\xC3\x89-non-ascii-block-Value"), std::string("\xC3\x8A-NON-ASCII-BLOCK-vALUE")));
+
+    ASSERT_TRUE(equal(std::wstring(L"Wide-Value-Longer-Than-Block"), std::wstring(L"wide-VALUE-longer-than-BLOCK")));
+    ASSERT_FALSE(equal(std::wstring(L"Wide"), std::wstring(L"Wine")));
+}
+
+} // namespace args
+} // namespace oct
@@ -0,0 +1,246 @@
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/octargs/octargs.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+namespace
+{
+
+const int THREAD_COUNT = 8;
+const int ITERATION_COUNT = 500;
+
+struct settings
+{
+    settings()
+        : m_verbose(false)
+        , m_level(0)
+        , m_files()
+    {
+        // noop
+    }
+
+    bool m_verbose;
+    int m_level;
+    std::vector<std::string> m_files;
+};
+
+template <typename function_T>
+void run_threads(function_T function)
+{
+    std::atomic<bool> start_flag(false);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < THREAD_COUNT; ++i)
+    {
+        threads.emplace_back([&start_flag, &function, i]() {
+            while (!start_flag)
+            {
+                std::this_thread::yield();
+            }
+            function(i);
+        });
+    }
+
+    start_flag = true;
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+} // namespace
+
+TEST(concurrency_test, test_shared_parser)
+{
+    auto dictionary = std::make_shared<custom_dictionary<char>>(custom_dictionary<char>::init_mode::WITH_DEFAULTS);
+    dictionary->set_case_sensitive(false);
+
+    parser parser(dictionary);
+    parser.add_switch({ "-v", "--verbose" });
+    parser.add_valued({ "--level" }).set_default_value("1").set_allowed_values({ "1", "2", "3" });
+    parser.add_positional("FILES").set_max_count_unlimited();
+
+    std::atomic<int> failure_count(0);
+
+    run_threads([&](int thread_index) {
+        for (int i = 0; i < ITERATION_COUNT; ++i)
+        {
+            auto file_name = "file" + std::to_string(thread_index) + "_" + std::to_string(i);
+            auto level = std::to_string(1 + (i % 3));
+
+            auto results = parser.parse(argument_table("app", { "--VERBOSE", "--level=" + level, file_name }));
+            if (!results.has_value("-v") || (results.get_first_value("--level") != level)
+                || (results.get_values("FILES") != std::vector<std::string> { file_name }))
+            {
+                ++failure_count;
+            }
+
+            try
+            {
+                parser.parse(argument_table("app", { "--level=4" }));
+                ++failure_count;
+            }
+            catch (const parser_error&)
+            {
+                // expected
+            }
+        }
+    });
+
+    ASSERT_EQ(0, failure_count.load());
+}
+
+TEST(concurrency_test, test_shared_subparsers)
+{
+    parser parser;
+    auto subparsers = parser.add_subparsers("COMMAND");
+
+    auto add_parser = subparsers.add_parser("add");
+    add_parser.add_valued({ "--name" }).set_min_count(1);
+
+    auto remove_parser = subparsers.add_parser("remove");
+    remove_parser.add_switch({ "--force" });
+    remove_parser.add_positional("ITEMS").set_min_count(1).set_max_count_unlimited();
+
+    auto compiled = parser.compile();
+
+    std::atomic<int> failure_count(0);
+
+    run_threads([&](int thread_index) {
+        for (int i = 0; i < ITERATION_COUNT; ++i)
+        {
+            auto name = std::to_string(thread_index * ITERATION_COUNT + i);
+
+            auto results1 = compiled.parse(argument_table("app", { "add", "--name", name }));
+            if ((results1.get_first_value("COMMAND") != "add") || (results1.get_first_value("add --name") != name))
+            {
+                ++failure_count;
+            }
+
+            auto results2 = parser.parse(argument_table("app", { "remove", "--force", name, name }));
+            if (!results2.has_value("remove --force") || (results2.get_count("remove ITEMS") != 2))
+            {
+                ++failure_count;
+            }
+        }
+    });
+
+    ASSERT_EQ(0, failure_count.load());
+}
+
+TEST(concurrency_test, test_shared_storing_parser)
+{
+    storing_parser<settings> parser;
+    parser.add_switch({ "--verbose" }).set_type_and_storage(&settings::m_verbose);
+    parser.add_valued({ "--level" }).set_type_and_storage(&settings::m_level);
+    parser.add_positional("FILES").set_max_count_unlimited().set_type_and_storage(&settings::m_files);
+
+    std::atomic<int> failure_count(0);
+
+    run_threads([&](int thread_index) {
+        for (int i = 0; i < ITERATION_COUNT; ++i)
+        {
+            auto level = thread_index * ITERATION_COUNT + i;
+            auto file_name = "file" + std::to_string(level);
+
+            settings thread_settings;
+            parser.parse(argument_table("app", { "--verbose", "--level", std::to_string(level), file_name }),
+                thread_settings);
+
+            if (!thread_settings.m_verbose || (thread_settings.m_level != level)
+                || (thread_settings.m_files != std::vector<std::string> { file_name }))
+            {
+                ++failure_count;
+            }
+        }
+    });
+
+    ASSERT_EQ(0, failure_count.load());
+}
+
+TEST(concurrency_test, test_parse_batch)
+{
+    std::vector<argument_table> arg_tables;
+    std::vector<parse_result> kept_results;
+    {
+        parser parser;
+        parser.add_valued({ "--level" }).set_type<int>();
+        parser.add_positional("FILES").set_max_count_unlimited();
+
+        for (int i = 0; i < ITERATION_COUNT * 3; ++i)
+        {
+            auto level = (i % 7 == 0) ? "x" : std::to_string(i);
+            arg_tables.push_back(argument_table("app", { "--level", level, "file" + std::to_string(i) }));
+        }
+
+        for (int thread_count : { 0, 1, 3, THREAD_COUNT })
+        {
+            auto batch_results = parser.parse_batch(arg_tables, static_cast<std::size_t>(thread_count));
+            ASSERT_EQ(arg_tables.size(), batch_results.size());
+
+            for (int i = 0; i < ITERATION_COUNT * 3; ++i)
+            {
+                auto& result = batch_results[static_cast<std::size_t>(i)];
+                if (i % 7 == 0)
+                {
+                    ASSERT_FALSE(result);
+                    EXPECT_TRUE(result.get_error_code() == parser_error_code::CONVERSION_FAILED);
+                    EXPECT_EQ(std::size_t(1), result.get_error_index());
+                }
+                else
+                {
+                    ASSERT_TRUE(result);
+                    EXPECT_EQ(i, result.get_results().get_first_value_as<int>("--level"));
+                    EXPECT_EQ("file" + std::to_string(i), result.get_results().get_first_value("FILES"));
+                }
+            }
+        }
+
+        auto compiled = parser.compile();
+        auto batch_results = compiled.parse_batch(arg_tables.begin() + 1, arg_tables.begin() + 3, THREAD_COUNT);
+        ASSERT_EQ(std::size_t(2), batch_results.size());
+        EXPECT_EQ(2, batch_results[1].get_results().get_first_value_as<int>("--level"));
+
+        ASSERT_TRUE(parser.parse_batch(arg_tables.end(), arg_tables.end()).empty());
+
+        kept_results = compiled.parse_batch(arg_tables, THREAD_COUNT);
+    }
+
+    // results stay valid after the parser is destroyed
+    ASSERT_EQ(arg_tables.size(), kept_results.size());
+    EXPECT_EQ(std::string("file5"), kept_results[5].get_results().get_first_value("FILES"));
+}
+
+TEST(concurrency_test, test_parse_batch_exception)
+{
+    parser parser;
+    parser.add_valued({ "--level" }).set_type<int>().set_convert_function([](const std::string& value_str) -> int {
+        if (value_str == "bad")
+        {
+            throw std::runtime_error("bad value");
+        }
+        return std::stoi(value_str);
+    });
+
+    std::vector<argument_table> arg_tables;
+    for (int i = 0; i < ITERATION_COUNT; ++i)
+    {
+        arg_tables.push_back(argument_table("app", { "--level", (i == ITERATION_COUNT / 2) ? "bad" : "1" }));
+    }
+
+    ASSERT_THROW(parser.parse_batch(arg_tables, THREAD_COUNT), std::runtime_error);
+}
+
+} // namespace args
+} // namespace oct
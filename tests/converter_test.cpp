@@ -96,6 +96,32 @@ TEST(converter_test, test_bool_converter)
     }
 }
 
+static_assert(internal::match_default_bool_literal("yes", 3) == 1, "yes is a true literal");
+static_assert(internal::match_default_bool_literal(L"0", 1) == 0, "0 is a false literal");
+static_assert(internal::match_default_bool_literal("True", 4) == -1, "default literals are case sensitive");
+
+TEST(converter_test, test_bool_converter_custom_dictionary)
+{
+    using dictionary_type = custom_dictionary<char>;
+
+    basic_converter<char, bool> converter;
+
+    dictionary_type dictionary(dictionary_type::init_mode::NO_DEFAULTS);
+    ASSERT_THROW(converter(dictionary, "true"), conversion_error);
+
+    dictionary.add_true_literal("on");
+    dictionary.add_false_literal("off");
+    dictionary.add_false_literal("on");
+    ASSERT_EQ(true, converter(dictionary, "on"));
+    ASSERT_EQ(false, converter(dictionary, "off"));
+    ASSERT_THROW(converter(dictionary, "OFF"), conversion_error);
+
+    dictionary.set_case_sensitive(false);
+    ASSERT_EQ(true, converter(dictionary, "On"));
+    ASSERT_EQ(false, converter(dictionary, "OFF"));
+    ASSERT_THROW(converter(dictionary, "of"), conversion_error);
+}
+
 template <typename value_T>
 void test_integer_converter()
 {
@@ -241,5 +267,93 @@ TEST(converter_test, test_float_converter_longdouble)
     test_float_converter<long double>();
 }
 
+TEST(converter_test, test_integer_converter_limits)
+{
+    basic_converter<char, short> short_converter;
+    ASSERT_EQ(short(-32768), short_converter("-32768"));
+    ASSERT_EQ(short(-32768), short_converter("-0x8000"));
+    ASSERT_EQ(short(32767), short_converter("+32767"));
+    ASSERT_THROW(short_converter("-32769"), conversion_error);
+    ASSERT_THROW(short_converter("32768"), conversion_error);
+    ASSERT_THROW(short_converter("- 1"), conversion_error);
+    ASSERT_THROW(short_converter("-"), conversion_error);
+    ASSERT_THROW(short_converter("0x"), conversion_error);
+
+    basic_converter<char, long long> llong_converter;
+    ASSERT_EQ(std::numeric_limits<long long>::min(), llong_converter("-9223372036854775808"));
+    ASSERT_EQ(std::numeric_limits<long long>::max(), llong_converter("0x7fffffffffffffff"));
+    ASSERT_THROW(llong_converter("9223372036854775808"), conversion_error);
+    ASSERT_THROW(llong_converter("-9223372036854775809"), conversion_error);
+
+    basic_converter<char, unsigned long long> ullong_converter;
+    ASSERT_EQ(std::numeric_limits<unsigned long long>::max(), ullong_converter("18446744073709551615"));
+    ASSERT_EQ(0ULL, ullong_converter("-0"));
+    ASSERT_THROW(ullong_converter("18446744073709551616"), conversion_error);
+    ASSERT_THROW(ullong_converter("-1"), conversion_error);
+
+    basic_converter<char, unsigned int> uint_converter;
+    ASSERT_THROW(uint_converter("-1"), conversion_error);
+}
+
+TEST(converter_test, test_try_convert_views)
+{
+    default_dictionary<char> dictionary;
+
+    // views of a part of the string (not null terminated)
+    std::string input("1234.5=true");
+    basic_string_view<char> input_view(input);
+
+    int int_value = 0;
+    ASSERT_TRUE((basic_converter<char, int>().try_convert(dictionary, input_view.substr(0, 4), int_value)));
+    ASSERT_EQ(1234, int_value);
+
+    double double_value = 0;
+    ASSERT_TRUE((basic_converter<char, double>().try_convert(dictionary, input_view.substr(0, 6), double_value)));
+    ASSERT_EQ(1234.5, double_value);
+    ASSERT_FALSE((basic_converter<char, double>().try_convert(dictionary, input_view.substr(0, 7), double_value)));
+
+    bool bool_value = false;
+    ASSERT_TRUE((basic_converter<char, bool>().try_convert(dictionary, input_view.substr(7), bool_value)));
+    ASSERT_TRUE(bool_value);
+
+    std::string string_value;
+    ASSERT_TRUE(
+        (basic_converter<char, std::string>().try_convert(dictionary, input_view.substr(0, 4), string_value)));
+    ASSERT_EQ(std::string("1234"), string_value);
+}
+
+TEST(converter_test, test_wchar_numeric_converters)
+{
+    basic_converter<wchar_t, int> int_converter;
+    ASSERT_EQ(42, int_converter(L" 42\t"));
+    ASSERT_EQ(-21, int_converter(L"-0x15"));
+    ASSERT_EQ(15, int_converter(L"017"));
+    ASSERT_THROW(int_converter(L"42a"), conversion_error);
+    ASSERT_THROW(int_converter(L"99999999999"), conversion_error);
+
+    basic_converter<wchar_t, double> double_converter;
+    ASSERT_DOUBLE_EQ(-21.5, double_converter(L" -21.5 "));
+    ASSERT_THROW(double_converter(L"1.5x"), conversion_error);
+    ASSERT_THROW(double_converter(L""), conversion_error);
+
+    try
+    {
+        int_converter(L"0xfg");
+        ASSERT_TRUE(false);
+    }
+    catch (const conversion_error_ex<wchar_t>& exc)
+    {
+        ASSERT_TRUE(std::wstring(L"0xfg") == exc.get_value());
+    }
+}
+
+TEST(converter_test, test_float_converter_long_value)
+{
+    basic_converter<char, double> converter;
+
+    ASSERT_DOUBLE_EQ(1.25, converter("1.25" + std::string(100, '0')));
+    ASSERT_THROW(converter("1e999999"), conversion_error);
+}
+
 } // namespace args
 } // namespace oct
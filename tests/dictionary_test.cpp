@@ -63,6 +63,28 @@ TEST(dictionary_test, test_switch_enabled_literal)
     ASSERT_EQ(true, results.get_first_value_as<bool>("--bool"));
 }
 
+TEST(dictionary_test, test_literals_changed_after_parse)
+{
+    using dictionary_type = custom_dictionary<char>;
+
+    auto dict = std::make_shared<dictionary_type>(dictionary_type::init_mode::WITH_DEFAULTS);
+
+    parser parser(dict);
+    parser.add_switch({ "--bool" });
+    parser.add_valued({ "--level" });
+
+    auto results = parser.parse(argument_table("app", { "--bool", "--level=1" }));
+    ASSERT_EQ(std::string("true"), results.get_first_value("--bool"));
+    ASSERT_EQ(std::string("1"), results.get_first_value("--level"));
+
+    dict->set_switch_enabled_literal("tak");
+    dict->set_value_separator_literal(":");
+
+    results = parser.parse(argument_table("app", { "--bool", "--level:2" }));
+    ASSERT_EQ(std::string("tak"), results.get_first_value("--bool"));
+    ASSERT_EQ(std::string("2"), results.get_first_value("--level"));
+}
+
 TEST(dictionary_test, test_no_defaults)
 {
     using dictionary_type = custom_dictionary<char>;
@@ -73,6 +95,10 @@ TEST(dictionary_test, test_no_defaults)
 
     ASSERT_EQ("domyślnie", dict->get_usage_literal(dictionary_type::usage_literal::DECORATOR_DEFAULT));
     ASSERT_THROW(dict->get_usage_literal(dictionary_type::usage_literal::DECORATOR_REQUIRED), invalid_dictionary_key);
+
+    auto invalid_key = static_cast<dictionary_type::usage_literal>(100);
+    ASSERT_THROW(dict->get_usage_literal(invalid_key), invalid_dictionary_key);
+    ASSERT_THROW(dict->set_usage_literal(invalid_key, "invalid"), invalid_dictionary_key);
 }
 
 TEST(dictionary_test, test_subparser_dictionary)
@@ -195,5 +221,31 @@ TEST(dictionary_test, test_ignore_case_allowed_values)
     ASSERT_EQ("file-NOT-found", results.get_first_value("--val"));
 }
 
+TEST(dictionary_test, test_case_sensitivity_changed_after_allowed_values)
+{
+    using dictionary_type = custom_dictionary<char>;
+
+    auto dict = std::make_shared<dictionary_type>(dictionary_type::init_mode::WITH_DEFAULTS);
+
+    parser parser(dict);
+    parser.add_valued({ "--val" }).set_allowed_values({ "yes", "no" });
+    auto cmd_parser = parser.add_subparsers("command").add_parser("cmd");
+    cmd_parser.add_positional("MODE").set_allowed_values({ "fast" });
+
+    ASSERT_THROW(parser.parse(argument_table("app", { "--val=YES" })), parser_error);
+    ASSERT_THROW(parser.parse(argument_table("app", { "cmd", "FAST" })), parser_error);
+
+    dict->set_case_sensitive(false);
+
+    auto results = parser.parse(argument_table("app", { "--val=YES", "cmd", "FAST" }));
+    ASSERT_EQ("YES", results.get_first_value("--val"));
+    ASSERT_EQ("FAST", results.get_first_value("cmd MODE"));
+
+    dict->set_case_sensitive(true);
+
+    ASSERT_THROW(parser.parse(argument_table("app", { "--val=YES" })), parser_error);
+    ASSERT_NO_THROW(parser.parse(argument_table("app", { "--val=yes", "cmd", "fast" })));
+}
+
 } // namespace args
 } // namespace oct
@@ -142,5 +142,50 @@ TEST(exclusive_args_test, test_subparsers)
     EXPECT_THROW(parser.parse(argument_table("appname", { "sub", "--help", "--verbose" })), parser_error);
 }
 
+TEST(exclusive_args_test, test_nested_subparsers_deferred)
+{
+    parser parser;
+    parser.add_valued({ "--config" }).set_min_count(1);
+    parser.add_valued({ "--level" }).set_default_value("1");
+    auto subparsers = parser.add_subparsers("command");
+    auto parser_remote = subparsers.add_parser("remote");
+    parser_remote.add_valued({ "--timeout" }).set_default_value("10");
+    auto remote_subparsers = parser_remote.add_subparsers("remote_command");
+    auto parser_add = remote_subparsers.add_parser("add");
+    parser_add.add_exclusive({ "--help" });
+    parser_add.add_positional("URL").set_min_count(1);
+
+    // requirements and defaults of the parent parsers are not processed
+    auto results_help = parser.parse(argument_table("appname", { "remote", "add", "--help" }));
+    ASSERT_EQ(std::size_t(1), results_help.get_count("remote add --help"));
+    ASSERT_EQ(std::size_t(0), results_help.get_count("command"));
+    ASSERT_EQ(std::size_t(0), results_help.get_count("--level"));
+    ASSERT_EQ(std::size_t(0), results_help.get_count("remote remote_command"));
+    ASSERT_EQ(std::size_t(0), results_help.get_count("remote --timeout"));
+
+    // exclusive argument used as a value
+    auto results_url = parser.parse(argument_table("appname", { "--config=a", "remote", "add", "--help" }));
+    ASSERT_EQ(std::size_t(0), results_url.get_count("remote add --help"));
+    ASSERT_EQ(std::string("--help"), results_url.get_first_value("remote add URL"));
+    ASSERT_EQ(std::string("1"), results_url.get_first_value("--level"));
+    ASSERT_EQ(std::string("remote"), results_url.get_first_value("command"));
+    ASSERT_EQ(std::string("add"), results_url.get_first_value("remote remote_command"));
+    ASSERT_EQ(std::string("10"), results_url.get_first_value("remote --timeout"));
+
+    try
+    {
+        parser.parse(argument_table("appname", { "remote", "add", "http://host" }));
+        FAIL() << "Exception not thrown";
+    }
+    catch (const parser_error_ex<char>& exc)
+    {
+        ASSERT_TRUE(exc.get_error_code() == parser_error_code::REQUIRED_ARGUMENT_MISSING);
+        ASSERT_EQ(std::string("--config"), exc.get_name());
+    }
+
+    EXPECT_THROW(parser.parse(argument_table("appname", { "remote", "--help" })), parser_error);
+    EXPECT_THROW(parser.parse(argument_table("appname", { "remote", "add", "--help=1" })), parser_error);
+}
+
 } // namespace args
 } // namespace oct
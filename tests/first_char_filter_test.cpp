@@ -0,0 +1,64 @@
+#include "gtest/gtest.h"
+
+#include <string>
+
+#include "../include/octargs/internal/first_char_filter.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+TEST(first_char_filter_test, test_empty)
+{
+    internal::basic_first_char_filter<char> filter(true);
+
+    ASSERT_FALSE(filter.may_match(""));
+    ASSERT_FALSE(filter.may_match("-"));
+    ASSERT_FALSE(filter.may_match("value"));
+}
+
+TEST(first_char_filter_test, test_case_sensitive)
+{
+    internal::basic_first_char_filter<char> filter(true);
+    filter.insert("--name");
+    filter.insert("Name");
+    filter.insert("");
+
+    ASSERT_TRUE(filter.may_match("-"));
+    ASSERT_TRUE(filter.may_match("--other=value"));
+    ASSERT_TRUE(filter.may_match("Nothing"));
+    ASSERT_FALSE(filter.may_match("name"));
+    ASSERT_FALSE(filter.may_match("/name"));
+    ASSERT_FALSE(filter.may_match(""));
+    ASSERT_FALSE(filter.may_match("\xC3\xA9"));
+}
+
+TEST(first_char_filter_test, test_case_insensitive)
+{
+    internal::basic_first_char_filter<char> filter(false);
+    filter.insert("Name");
+    filter.insert("/help");
+
+    ASSERT_TRUE(filter.may_match("name"));
+    ASSERT_TRUE(filter.may_match("NAME"));
+    ASSERT_TRUE(filter.may_match("/"));
+    ASSERT_FALSE(filter.may_match("-name"));
+    ASSERT_FALSE(filter.may_match("value"));
+}
+
+TEST(first_char_filter_test, test_wide_chars)
+{
+    internal::basic_first_char_filter<wchar_t> filter(true);
+    filter.insert(L"--name");
+
+    ASSERT_TRUE(filter.may_match(L"--name"));
+    ASSERT_FALSE(filter.may_match(L"Аvalue"));
+
+    filter.insert(L"Аname");
+    ASSERT_TRUE(filter.may_match(L"Аvalue"));
+    ASSERT_FALSE(filter.may_match(L"value"));
+}
+
+} // namespace args
+} // namespace oct
@@ -1,11 +1,33 @@
 #ifndef OCTARGS_TESTS_HELPERS_HPP
 #define OCTARGS_TESTS_HELPERS_HPP
 
+#include <string>
+#include <vector>
+
 namespace oct
 {
 namespace args
 {
+namespace test
+{
+
+/// \brief Values storage used by storing parser tests
+struct settings
+{
+    settings()
+        : m_verbose(false)
+        , m_level(0)
+        , m_files()
+    {
+        // noop
+    }
+
+    bool m_verbose;
+    int m_level;
+    std::vector<std::string> m_files;
+};
 
+} // namespace test
 } // namespace args
 } // namespace oct
 
@@ -0,0 +1,80 @@
+#include "gtest/gtest.h"
+
+#include <string>
+
+#include "../include/octargs/internal/name_index.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+TEST(name_index_test, test_empty)
+{
+    internal::basic_name_index<char, int> index(true);
+
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(std::size_t(0), index.size());
+    ASSERT_TRUE(index.find("--name") == nullptr);
+    ASSERT_TRUE(index.find("") == nullptr);
+
+    internal::basic_name_index<char, int> index_ci(false);
+    ASSERT_TRUE(index_ci.find("") == nullptr);
+}
+
+TEST(name_index_test, test_case_sensitive)
+{
+    internal::basic_name_index<char, int> index(true);
+
+    ASSERT_TRUE(index.is_case_sensitive());
+    ASSERT_TRUE(index.insert("--name", 1));
+    ASSERT_TRUE(index.insert("--Name", 2));
+    ASSERT_FALSE(index.insert("--name", 3));
+    ASSERT_EQ(std::size_t(2), index.size());
+
+    ASSERT_EQ(1, *index.find("--name"));
+    ASSERT_EQ(2, *index.find("--Name"));
+    ASSERT_TRUE(index.find("--NAME") == nullptr);
+    ASSERT_TRUE(index.find("--nam") == nullptr);
+    ASSERT_TRUE(index.find("") == nullptr);
+}
+
+TEST(name_index_test, test_case_insensitive)
+{
+    internal::basic_name_index<char, int> index(false);
+
+    ASSERT_FALSE(index.is_case_sensitive());
+    ASSERT_TRUE(index.insert("--Name", 1));
+    ASSERT_FALSE(index.insert("--nAME", 2));
+    ASSERT_EQ(std::size_t(1), index.size());
+
+    ASSERT_EQ(1, *index.find("--name"));
+    ASSERT_EQ(1, *index.find("--NAME"));
+
+    std::string input = "--NAME=value";
+    ASSERT_EQ(1, *index.find(input.data(), 6));
+    ASSERT_TRUE(index.find(input.data(), 5) == nullptr);
+}
+
+TEST(name_index_test, test_rehash)
+{
+    internal::basic_name_index<wchar_t, std::size_t> index(true);
+
+    const std::size_t COUNT = 1000;
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        ASSERT_TRUE(index.insert(L"--arg" + std::to_wstring(i), i));
+    }
+    ASSERT_EQ(COUNT, index.size());
+
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        auto value_ptr = index.find(L"--arg" + std::to_wstring(i));
+        ASSERT_TRUE(value_ptr != nullptr);
+        ASSERT_EQ(i, *value_ptr);
+    }
+    ASSERT_TRUE(index.find(L"--arg" + std::to_wstring(COUNT)) == nullptr);
+}
+
+} // namespace args
+} // namespace oct
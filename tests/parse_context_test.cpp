@@ -0,0 +1,126 @@
+#include "gtest/gtest.h"
+
+#include "../include/octargs/octargs.hpp"
+
+#include "allocation_counter.hpp"
+#include "helpers.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+using test::settings;
+
+TEST(parse_context_test, test_results)
+{
+    parser parser;
+    parser.add_switch({ "-v" });
+    parser.add_valued({ "--level" }).set_default_value("1");
+    parser.add_positional("values").set_max_count_unlimited();
+
+    parse_context context;
+
+    auto results1 = parser.parse(argument_table("app", { "-v", "--level=2", "a", "b" }), context);
+    ASSERT_TRUE(results1.has_value("-v"));
+    ASSERT_EQ(std::string("2"), results1.get_first_value("--level"));
+    ASSERT_EQ(std::size_t(2), results1.get_count("values"));
+
+    // previous results still referenced so they must stay unchanged
+    auto results2 = parser.parse(argument_table("app", { "c" }), context);
+    ASSERT_TRUE(!results2.has_value("-v"));
+    ASSERT_EQ(std::string("1"), results2.get_first_value("--level"));
+    ASSERT_EQ(std::string("c"), results2.get_first_value("values"));
+    ASSERT_TRUE(results1.has_value("-v"));
+    ASSERT_EQ(std::size_t(2), results1.get_count("values"));
+
+    parser.add_switch({ "-q" });
+
+    auto results3 = parser.parse(argument_table("app", { "-q" }), context);
+    ASSERT_TRUE(results3.has_value("-q"));
+    ASSERT_EQ(std::size_t(0), results3.get_count("values"));
+}
+
+TEST(parse_context_test, test_reuse)
+{
+    parser parser;
+    parser.add_switch({ "-v" });
+    parser.add_positional("values").set_max_count_unlimited();
+
+    parse_context context;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        auto results = parser.parse(argument_table("app", { "-v", "a", "b" }), context);
+        ASSERT_TRUE(results.has_value("-v"));
+        ASSERT_EQ(std::size_t(2), results.get_count("values"));
+        ASSERT_EQ(std::string("b"), results.get_values("values")[1]);
+    }
+
+    auto results = parser.parse(argument_table("app", {}), context);
+    ASSERT_TRUE(!results.has_value("-v"));
+    ASSERT_EQ(std::size_t(0), results.get_count("values"));
+    ASSERT_TRUE(results.get_values("values").empty());
+}
+
+TEST(parse_context_test, test_steady_state_allocations)
+{
+    const char* argv[] = { "app", "--verbose", "--level=3", "--count=00000000000000000000000000000042",
+        "--ratio=0.50000000000000000000000000000", "add", "--name", "long_value_not_fitting_in_sso", nullptr };
+    int argc = 8;
+
+    parser parser;
+    parser.add_switch({ "-v", "--verbose" });
+    parser.add_valued({ "--level" }).set_default_value("1").set_allowed_values({ "1", "2", "3" });
+    parser.add_valued({ "--count" }).set_type<int>();
+    parser.add_valued({ "--ratio" }).set_type<double>();
+    auto subparsers = parser.add_subparsers("COMMAND");
+    subparsers.add_parser("add").add_valued({ "--name" });
+    subparsers.add_parser("positional").add_positional("values").set_max_count_unlimited();
+
+    auto compiled = parser.compile();
+
+    parse_context context;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        parser.parse(argc, argv, context);
+        compiled.parse(argc, argv, context);
+    }
+
+    auto allocation_count = g_allocation_count.load();
+    for (int i = 0; i < 100; ++i)
+    {
+        auto results = parser.parse(argc, argv, context);
+        ASSERT_TRUE(results.has_value("add --name"));
+    }
+    for (int i = 0; i < 100; ++i)
+    {
+        auto results = compiled.parse(argc, argv, context);
+        ASSERT_TRUE(results.get_value_views("add --name").size() == 1);
+    }
+    ASSERT_EQ(allocation_count, g_allocation_count.load());
+}
+
+TEST(parse_context_test, test_storing_parser)
+{
+    const char* argv[] = { "app", "-v", "--level", "7", nullptr };
+
+    storing_parser<settings> parser;
+    parser.add_switch({ "-v" }).set_type_and_storage(&settings::m_verbose);
+    parser.add_valued({ "--level" }).set_type_and_storage(&settings::m_level);
+
+    parse_context context;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        settings values;
+        auto results = parser.parse(4, argv, values, context);
+        ASSERT_TRUE(values.m_verbose);
+        ASSERT_EQ(7, values.m_level);
+        ASSERT_EQ(std::string("7"), results.get_first_value("--level"));
+    }
+}
+
+} // namespace args
+} // namespace oct
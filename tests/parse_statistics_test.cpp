@@ -0,0 +1,254 @@
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+#include "../include/octargs/octargs.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+namespace
+{
+
+parser create_parser()
+{
+    parser parser;
+    parser.add_switch({ "-v", "--verbose" });
+    parser.add_valued({ "-l", "--level" }).set_type<int>().set_default_value("1");
+    parser.add_positional("file").set_min_count(1);
+    return parser;
+}
+
+} // namespace
+
+TEST(parse_statistics_test, test_histogram)
+{
+    using std::chrono::nanoseconds;
+
+    EXPECT_EQ(0, duration_histogram::get_bucket_index(nanoseconds(0)));
+    EXPECT_EQ(1, duration_histogram::get_bucket_index(nanoseconds(1)));
+    EXPECT_EQ(2, duration_histogram::get_bucket_index(nanoseconds(2)));
+    EXPECT_EQ(2, duration_histogram::get_bucket_index(nanoseconds(3)));
+    EXPECT_EQ(11, duration_histogram::get_bucket_index(nanoseconds(1024)));
+    EXPECT_EQ(duration_histogram::BUCKET_COUNT - 1, duration_histogram::get_bucket_index(std::chrono::hours(24)));
+
+    EXPECT_EQ(1, duration_histogram::get_bucket_limit_ns(0));
+    EXPECT_EQ(2048, duration_histogram::get_bucket_limit_ns(11));
+
+    duration_histogram histogram;
+    EXPECT_EQ(0, histogram.get_count());
+    EXPECT_EQ(nanoseconds(0), histogram.get_mean());
+
+    histogram.add(nanoseconds(100));
+    histogram.add(nanoseconds(300));
+    histogram.add(nanoseconds(1100));
+
+    EXPECT_EQ(3, histogram.get_count());
+    EXPECT_EQ(nanoseconds(1500), histogram.get_total());
+    EXPECT_EQ(nanoseconds(500), histogram.get_mean());
+    EXPECT_EQ(nanoseconds(1100), histogram.get_max());
+    EXPECT_EQ(1, histogram.get_bucket_count(7));
+    EXPECT_EQ(1, histogram.get_bucket_count(9));
+    EXPECT_EQ(1, histogram.get_bucket_count(11));
+    EXPECT_EQ(0, histogram.get_bucket_count(10));
+}
+
+TEST(parse_statistics_test, test_dump_last_bucket)
+{
+    // durations are reported by the observer interface, so no parsing is needed
+    parse_statistics statistics;
+    statistics.on_parse_end(true, std::chrono::nanoseconds(100));
+    statistics.on_parse_end(true, std::chrono::hours(24));
+
+    std::ostringstream os;
+    statistics.dump(os);
+
+    auto text = os.str();
+    EXPECT_NE(std::string::npos, text.find("  < 128 ns: 1\n"));
+    EXPECT_NE(std::string::npos, text.find("  >= 274877906944 ns: 1\n"));
+    EXPECT_EQ(std::string::npos, text.find("< 549755813888 ns"));
+}
+
+TEST(parse_statistics_test, test_counters)
+{
+    auto statistics = std::make_shared<parse_statistics>();
+
+    auto parser = create_parser();
+    parser.set_parse_observer(statistics);
+
+    parser.parse(argument_table("app", { "-v", "--level", "3", "file.txt" }));
+
+    EXPECT_EQ(1, statistics->get_parse_count());
+    EXPECT_EQ(0, statistics->get_failed_count());
+    EXPECT_EQ(4, statistics->get_token_count());
+    // positional value is looked up as it starts like the positional argument name
+    EXPECT_EQ(2, statistics->get_lookup_hit_count());
+    EXPECT_EQ(1, statistics->get_lookup_miss_count());
+
+    EXPECT_EQ(1, statistics->get_phase_histogram(parse_phase::LEADING_ARGUMENTS).get_count());
+    EXPECT_EQ(1, statistics->get_phase_histogram(parse_phase::NAMED_ARGUMENTS).get_count());
+    EXPECT_EQ(1, statistics->get_phase_histogram(parse_phase::POSITIONAL_ARGUMENTS).get_count());
+    EXPECT_EQ(1, statistics->get_phase_histogram(parse_phase::DEFAULT_VALUES).get_count());
+    EXPECT_EQ(1, statistics->get_phase_histogram(parse_phase::VALUES_COUNT_CHECK).get_count());
+
+    EXPECT_EQ(1, statistics->get_converter_histogram("-l").get_count());
+    EXPECT_EQ(1, statistics->get_handler_histogram("-l").get_count());
+    EXPECT_EQ(0, statistics->get_converter_histogram("-v").get_count());
+    EXPECT_EQ(0, statistics->get_handler_histogram("-v").get_count());
+
+    // unknown name is looked up and taken as the positional value
+    parser.parse(argument_table("app", { "--lvl=3" }));
+    // conversion fails (before the positional value is looked up)
+    EXPECT_FALSE(parser.try_parse(argument_table("app", { "-l", "abc", "file.txt" })));
+
+    EXPECT_EQ(3, statistics->get_parse_count());
+    EXPECT_EQ(1, statistics->get_failed_count());
+    EXPECT_EQ(8, statistics->get_token_count());
+    EXPECT_EQ(3, statistics->get_lookup_hit_count());
+    EXPECT_EQ(2, statistics->get_lookup_miss_count());
+    // default value stored (but not converted again) for the second parse,
+    // handler not called for the value rejected by the converter
+    EXPECT_EQ(2, statistics->get_converter_histogram("-l").get_count());
+    EXPECT_EQ(2, statistics->get_handler_histogram("-l").get_count());
+    EXPECT_EQ(3, statistics->get_parse_histogram().get_count());
+
+    statistics->reset();
+
+    EXPECT_EQ(0, statistics->get_parse_count());
+    EXPECT_EQ(0, statistics->get_token_count());
+    EXPECT_EQ(0, statistics->get_lookup_hit_count());
+    EXPECT_EQ(0, statistics->get_phase_histogram(parse_phase::NAMED_ARGUMENTS).get_count());
+    EXPECT_EQ(0, statistics->get_converter_histogram("-l").get_count());
+    EXPECT_EQ(0, statistics->get_handler_histogram("-l").get_count());
+
+    parser.set_parse_observer(nullptr);
+    parser.parse(argument_table("app", { "file.txt" }));
+
+    EXPECT_EQ(0, statistics->get_parse_count());
+}
+
+TEST(parse_statistics_test, test_subparsers)
+{
+    auto statistics = std::make_shared<parse_statistics>();
+
+    parser parser;
+    parser.set_parse_observer(statistics);
+    auto subparsers = parser.add_subparsers("command");
+    subparsers.add_parser("add").add_positional("values").set_max_count_unlimited();
+    subparsers.add_parser("sub").add_switch({ "-q" });
+
+    parser.parse(argument_table("app", { "add", "1", "2" }));
+    parser.parse(argument_table("app", { "sub", "-q" }));
+
+    EXPECT_EQ(2, statistics->get_parse_count());
+    EXPECT_EQ(0, statistics->get_failed_count());
+    // subparser names and -q
+    EXPECT_EQ(3, statistics->get_lookup_hit_count());
+    // leading arguments of the parser and of the subparser
+    EXPECT_EQ(4, statistics->get_phase_histogram(parse_phase::LEADING_ARGUMENTS).get_count());
+}
+
+TEST(parse_statistics_test, test_subparsers_same_argument_names)
+{
+    auto statistics = std::make_shared<parse_statistics>();
+
+    parser parser;
+    parser.set_parse_observer(statistics);
+    parser.add_valued({ "--level" }).set_type<int>();
+    auto subparsers = parser.add_subparsers("command");
+    subparsers.add_parser("add").add_valued({ "--level" }).set_type<int>();
+    subparsers.add_parser("sub").add_valued({ "--level" }).set_type<int>();
+
+    parser.parse(argument_table("app", { "--level", "1", "add", "--level", "2" }));
+    parser.parse(argument_table("app", { "sub", "--level", "3" }));
+    parser.parse(argument_table("app", { "sub", "--level", "4" }));
+
+    EXPECT_EQ(1, statistics->get_converter_histogram("--level").get_count());
+    EXPECT_EQ(1, statistics->get_converter_histogram("add --level").get_count());
+    EXPECT_EQ(2, statistics->get_converter_histogram("sub --level").get_count());
+    EXPECT_EQ(2, statistics->get_handler_histogram("sub --level").get_count());
+
+    std::ostringstream os;
+    statistics->dump(os);
+
+    auto text = os.str();
+    EXPECT_NE(std::string::npos, text.find("converter add --level: count 1"));
+    EXPECT_NE(std::string::npos, text.find("converter sub --level: count 2"));
+}
+
+TEST(parse_statistics_test, test_slow_handler)
+{
+    auto statistics = std::make_shared<parse_statistics>();
+
+    auto parser = create_parser();
+    parser.set_parse_observer(statistics);
+    parser.add_valued({ "--slow" }).set_type<int>().set_check_function([](int /*value*/) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    });
+
+    parser.parse(argument_table("app", { "--slow", "1", "file.txt" }));
+
+    auto histogram = statistics->get_handler_histogram("--slow");
+    EXPECT_EQ(1, histogram.get_count());
+    EXPECT_GE(histogram.get_max(), std::chrono::milliseconds(2));
+    EXPECT_GE(statistics->get_phase_histogram(parse_phase::NAMED_ARGUMENTS).get_max(), std::chrono::milliseconds(2));
+    EXPECT_GE(statistics->get_parse_histogram().get_max(), std::chrono::milliseconds(2));
+
+    std::ostringstream os;
+    statistics->dump(os);
+
+    auto text = os.str();
+    EXPECT_NE(std::string::npos, text.find("parses: 1 (failed: 0)\n"));
+    EXPECT_NE(std::string::npos, text.find("tokens: 3\n"));
+    EXPECT_NE(std::string::npos, text.find("phase named arguments: count 1"));
+    EXPECT_NE(std::string::npos, text.find("handler --slow: count 1"));
+}
+
+TEST(parse_statistics_test, test_slow_converter)
+{
+    auto statistics = std::make_shared<parse_statistics>();
+
+    auto parser = create_parser();
+    parser.set_parse_observer(statistics);
+    parser.add_valued({ "--slow" })
+        .set_type<int>()
+        .set_convert_function([](const std::string& value_str) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            return std::stoi(value_str);
+        })
+        .set_check_function([](int value) {
+            if (value < 0)
+            {
+                throw conversion_error_ex<char>(std::to_string(value));
+            }
+        });
+
+    auto results = parser.parse(argument_table("app", { "--slow", "1", "file.txt" }));
+    EXPECT_EQ(1, results.get_first_value_as<int>("--slow"));
+
+    auto converter_histogram = statistics->get_converter_histogram("--slow");
+    EXPECT_EQ(1, converter_histogram.get_count());
+    EXPECT_GE(converter_histogram.get_max(), std::chrono::milliseconds(2));
+
+    auto handler_histogram = statistics->get_handler_histogram("--slow");
+    EXPECT_EQ(1, handler_histogram.get_count());
+    EXPECT_LT(handler_histogram.get_max(), std::chrono::milliseconds(2));
+
+    // check function is still called when converter and handler are timed separately
+    EXPECT_FALSE(parser.try_parse(argument_table("app", { "--slow=-1", "file.txt" })));
+    EXPECT_EQ(2, statistics->get_converter_histogram("--slow").get_count());
+
+    std::ostringstream os;
+    statistics->dump(os);
+
+    auto text = os.str();
+    EXPECT_NE(std::string::npos, text.find("converter --slow: count 2"));
+    EXPECT_NE(std::string::npos, text.find("handler --slow: count 2"));
+}
+
+} // namespace args
+} // namespace oct
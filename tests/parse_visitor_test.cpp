@@ -0,0 +1,267 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+#include "../include/octargs/octargs.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+namespace
+{
+
+struct visited_value
+{
+    std::size_t m_id;
+    std::string m_name;
+    std::string m_qualified_name;
+    std::string m_value;
+    std::size_t m_arg_index;
+};
+
+class recording_visitor : public parse_visitor
+{
+public:
+    void on_value(const argument_handle& argument, string_view_type value, std::size_t arg_index) override
+    {
+        m_values.push_back(visited_value {
+            argument.get_id(), argument.get_name(), argument.get_qualified_name(), value.to_string(), arg_index });
+    }
+
+    std::vector<visited_value> m_values;
+};
+
+void check_parse_error(const parser& parser, const argument_table& args, parser_error_code code)
+{
+    recording_visitor visitor;
+    try
+    {
+        parser.visit(args, visitor);
+        FAIL() << "Exception not thrown";
+    }
+    catch (const parser_error_ex<char>& exc)
+    {
+        ASSERT_TRUE(exc.get_error_code() == code);
+    }
+}
+
+} // namespace
+
+TEST(parse_visitor_test, test_command_line_order)
+{
+    parser parser;
+    parser.add_switch({ "-v", "--verbose" });
+    parser.add_valued({ "-j", "--jobs" }).set_max_count_unlimited();
+    parser.add_positional("FILES").set_max_count_unlimited();
+
+    argument_table args("appname", { "--jobs=4", "-v", "-j", "8", "a.txt", "b.txt" });
+
+    recording_visitor visitor;
+    parser.visit(args, visitor);
+
+    ASSERT_EQ(std::size_t(5), visitor.m_values.size());
+
+    EXPECT_EQ(std::string("-j"), visitor.m_values[0].m_name);
+    EXPECT_EQ(std::string("4"), visitor.m_values[0].m_value);
+    EXPECT_EQ(std::size_t(0), visitor.m_values[0].m_arg_index);
+
+    EXPECT_EQ(std::string("-v"), visitor.m_values[1].m_name);
+    EXPECT_EQ(std::string("true"), visitor.m_values[1].m_value);
+    EXPECT_EQ(std::size_t(1), visitor.m_values[1].m_arg_index);
+
+    EXPECT_EQ(std::string("-j"), visitor.m_values[2].m_name);
+    EXPECT_EQ(std::string("8"), visitor.m_values[2].m_value);
+    EXPECT_EQ(std::size_t(3), visitor.m_values[2].m_arg_index);
+    EXPECT_EQ(visitor.m_values[0].m_id, visitor.m_values[2].m_id);
+
+    EXPECT_EQ(std::string("FILES"), visitor.m_values[3].m_name);
+    EXPECT_EQ(std::string("a.txt"), visitor.m_values[3].m_value);
+    EXPECT_EQ(std::size_t(4), visitor.m_values[3].m_arg_index);
+
+    EXPECT_EQ(std::string("FILES"), visitor.m_values[4].m_name);
+    EXPECT_EQ(std::string("b.txt"), visitor.m_values[4].m_value);
+    EXPECT_EQ(std::size_t(5), visitor.m_values[4].m_arg_index);
+}
+
+TEST(parse_visitor_test, test_default_values)
+{
+    parser parser;
+    parser.add_valued({ "--level" }).set_default_value("5");
+    parser.add_valued({ "--mode" }).set_default_value("fast");
+
+    argument_table args("appname", { "--mode", "slow" });
+
+    recording_visitor visitor;
+    parser.visit(args, visitor);
+
+    ASSERT_EQ(std::size_t(2), visitor.m_values.size());
+
+    EXPECT_EQ(std::string("--mode"), visitor.m_values[0].m_name);
+    EXPECT_EQ(std::string("slow"), visitor.m_values[0].m_value);
+    EXPECT_EQ(std::size_t(1), visitor.m_values[0].m_arg_index);
+
+    EXPECT_EQ(std::string("--level"), visitor.m_values[1].m_name);
+    EXPECT_EQ(std::string("5"), visitor.m_values[1].m_value);
+    EXPECT_EQ(parse_visitor::DEFAULT_VALUE_INDEX, visitor.m_values[1].m_arg_index);
+}
+
+TEST(parse_visitor_test, test_validation)
+{
+    parser parser;
+    parser.add_valued({ "--level" }).set_allowed_values({ "low", "high" });
+    parser.add_positional("FILE").set_min_count(1);
+
+    check_parse_error(
+        parser, argument_table("appname", { "--level=mid", "a.txt" }), parser_error_code::VALUE_NOT_ALLOWED);
+    check_parse_error(parser, argument_table("appname", { "--level=low", "--level=high", "a.txt" }),
+        parser_error_code::TOO_MANY_OCCURRENCES);
+    check_parse_error(
+        parser, argument_table("appname", { "--level=low" }), parser_error_code::REQUIRED_ARGUMENT_MISSING);
+}
+
+TEST(parse_visitor_test, test_subparsers)
+{
+    parser parser;
+    parser.add_switch({ "-v" });
+    auto subparsers = parser.add_subparsers("command");
+
+    auto add_parser = subparsers.add_parser("add");
+    add_parser.add_positional("values").set_max_count_unlimited();
+
+    auto mul_parser = subparsers.add_parser("mul");
+    mul_parser.add_positional("values").set_max_count_unlimited();
+
+    argument_table args("appname", { "-v", "mul", "2", "4" });
+
+    recording_visitor visitor;
+    parser.visit(args, visitor);
+
+    ASSERT_EQ(std::size_t(4), visitor.m_values.size());
+    EXPECT_EQ(std::string("-v"), visitor.m_values[0].m_name);
+    EXPECT_EQ(std::string("command"), visitor.m_values[1].m_name);
+    EXPECT_EQ(std::string("mul"), visitor.m_values[1].m_value);
+    EXPECT_EQ(std::size_t(1), visitor.m_values[1].m_arg_index);
+    EXPECT_EQ(std::string("values"), visitor.m_values[2].m_name);
+    EXPECT_EQ(std::string("2"), visitor.m_values[2].m_value);
+    EXPECT_EQ(std::size_t(2), visitor.m_values[2].m_arg_index);
+    EXPECT_EQ(std::string("4"), visitor.m_values[3].m_value);
+    EXPECT_EQ(std::size_t(3), visitor.m_values[3].m_arg_index);
+
+    // the same names in different subparsers are different arguments
+    recording_visitor add_visitor;
+    parser.visit(argument_table("appname", { "add", "1" }), add_visitor);
+
+    ASSERT_EQ(std::size_t(2), add_visitor.m_values.size());
+    EXPECT_EQ(std::string("values"), add_visitor.m_values[1].m_name);
+    EXPECT_NE(visitor.m_values[2].m_id, add_visitor.m_values[1].m_id);
+    EXPECT_EQ(std::string("mul values"), visitor.m_values[2].m_qualified_name);
+    EXPECT_EQ(std::string("add values"), add_visitor.m_values[1].m_qualified_name);
+    EXPECT_EQ(std::string("-v"), visitor.m_values[0].m_qualified_name);
+}
+
+TEST(parse_visitor_test, test_exclusive)
+{
+    parser parser;
+    parser.add_exclusive({ "--help" });
+    parser.add_positional("FILE").set_min_count(1);
+
+    recording_visitor visitor;
+    parser.visit(argument_table("appname", { "--help" }), visitor);
+
+    ASSERT_EQ(std::size_t(1), visitor.m_values.size());
+    EXPECT_EQ(std::string("--help"), visitor.m_values[0].m_name);
+    EXPECT_EQ(std::size_t(0), visitor.m_values[0].m_arg_index);
+}
+
+TEST(parse_visitor_test, test_storing_parser)
+{
+    struct settings
+    {
+        int m_level;
+        std::vector<std::string> m_files;
+    };
+
+    storing_parser<settings> parser;
+    parser.add_valued({ "--level" }).set_type_and_storage(&settings::m_level);
+    parser.add_positional("FILES").set_max_count_unlimited().set_type_and_storage(&settings::m_files);
+
+    argument_table args("appname", { "--level=7", "a.txt", "b.txt" });
+
+    settings values;
+    recording_visitor visitor;
+    parser.visit(args, values, visitor);
+
+    EXPECT_EQ(std::size_t(3), visitor.m_values.size());
+    EXPECT_EQ(7, values.m_level);
+    ASSERT_EQ(std::size_t(2), values.m_files.size());
+    EXPECT_EQ(std::string("b.txt"), values.m_files[1]);
+
+    recording_visitor invalid_visitor;
+    ASSERT_THROW(parser.visit(argument_table("appname", { "--level=x" }), values, invalid_visitor), parser_error);
+    EXPECT_TRUE(invalid_visitor.m_values.empty());
+}
+
+TEST(parse_visitor_test, test_compiled_parser)
+{
+    parser parser;
+    parser.add_valued({ "--name" });
+    parser.add_positional("FILES").set_max_count_unlimited();
+
+    auto compiled = parser.compile();
+
+    recording_visitor visitor;
+    compiled.visit(argument_table("appname", { "--name", "abc", "x.txt" }), visitor);
+
+    ASSERT_EQ(std::size_t(2), visitor.m_values.size());
+    EXPECT_EQ(std::string("--name"), visitor.m_values[0].m_name);
+    EXPECT_EQ(std::size_t(1), visitor.m_values[0].m_arg_index);
+    EXPECT_EQ(std::string("FILES"), visitor.m_values[1].m_name);
+    EXPECT_EQ(std::size_t(2), visitor.m_values[1].m_arg_index);
+}
+
+TEST(parse_visitor_test, test_values_as_range)
+{
+    parser parser;
+    parser.add_switch({ "-v" });
+    parser.add_positional("FILES").set_max_count_unlimited().set_values_as_range();
+
+    recording_visitor visitor;
+    parser.visit(argument_table("appname", { "-v", "a.txt", "b.txt" }), visitor);
+
+    ASSERT_EQ(std::size_t(3), visitor.m_values.size());
+    EXPECT_EQ(std::string("a.txt"), visitor.m_values[1].m_value);
+    EXPECT_EQ(std::size_t(1), visitor.m_values[1].m_arg_index);
+    EXPECT_EQ(std::string("b.txt"), visitor.m_values[2].m_value);
+    EXPECT_EQ(std::size_t(2), visitor.m_values[2].m_arg_index);
+}
+
+TEST(parse_visitor_test, test_wchar)
+{
+    class last_value_visitor : public wparse_visitor
+    {
+    public:
+        void on_value(const wargument_handle& argument, string_view_type value, std::size_t /*arg_index*/) override
+        {
+            m_last_name = argument.get_name();
+            m_last_value = value.to_string();
+        }
+
+        std::wstring m_last_name;
+        std::wstring m_last_value;
+    };
+
+    wparser parser;
+    parser.add_valued({ L"--name" });
+
+    last_value_visitor visitor;
+    parser.visit(wargument_table(L"appname", { L"--name=abc" }), visitor);
+
+    EXPECT_EQ(std::wstring(L"--name"), visitor.m_last_name);
+    EXPECT_EQ(std::wstring(L"abc"), visitor.m_last_value);
+}
+
+} // namespace args
+} // namespace oct
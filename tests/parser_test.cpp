@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
 
+#include <memory>
+
 #include "../include/octargs/octargs.hpp"
 
 namespace oct
@@ -34,6 +36,18 @@ public:
     }
 };
 
+int g_counting_converter_calls = 0;
+
+class counting_int_converter
+{
+public:
+    int operator()(const std::string& value_str) const
+    {
+        ++g_counting_converter_calls;
+        return std::stoi(value_str);
+    }
+};
+
 inline std::ostream& operator<<(std::ostream& os, format_code code)
 {
     return os << static_cast<int>(code);
@@ -103,6 +117,119 @@ TEST(parser_test, test_unknown_argument)
     ASSERT_THROW(parser.parse(args), parser_error);
 }
 
+TEST(parser_test, test_compiled_parse)
+{
+    parser parser;
+    parser.add_switch({ "-v", "--verbose" });
+    parser.add_valued({ "--level" });
+    parser.add_positional("values").set_max_count_unlimited();
+
+    auto compiled = parser.compile();
+
+    auto results1 = compiled.parse(argument_table("appname", { "--verbose", "--level=3", "argument1" }));
+    ASSERT_TRUE(results1.has_value("-v"));
+    ASSERT_EQ(std::string("3"), results1.get_first_value("--level"));
+    ASSERT_EQ(std::size_t(1), results1.get_count("values"));
+
+    auto results2 = compiled.parse(argument_table("appname", { "--level", "5" }));
+    ASSERT_TRUE(!results2.has_value("--verbose"));
+    ASSERT_EQ(std::string("5"), results2.get_first_value("--level"));
+    ASSERT_EQ(std::size_t(0), results2.get_count("values"));
+
+    ASSERT_THROW(compiled.parse(argument_table("appname", { "--level" })), parser_error);
+}
+
+TEST(parser_test, test_compiled_is_immutable)
+{
+    parser parser;
+    parser.add_switch({ "-v" });
+
+    auto compiled = parser.compile();
+
+    parser.add_switch({ "-q" });
+
+    ASSERT_THROW(compiled.parse(argument_table("appname", { "-q" })), parser_error);
+    ASSERT_TRUE(parser.parse(argument_table("appname", { "-q" })).has_value("-q"));
+    ASSERT_TRUE(parser.compile().parse(argument_table("appname", { "-q" })).has_value("-q"));
+}
+
+TEST(parser_test, test_argument_modified_after_parse)
+{
+    parser parser;
+    auto level = parser.add_valued({ "--level" });
+    auto name = parser.add_valued({ "--name" });
+
+    auto results = parser.parse(argument_table("appname", {}));
+    ASSERT_FALSE(results.has_value("--level"));
+
+    level.set_default_value("3");
+    name.set_min_count(1);
+
+    ASSERT_THROW(parser.parse(argument_table("appname", {})), parser_error);
+
+    results = parser.parse(argument_table("appname", { "--name=x" }));
+    ASSERT_EQ(std::string("3"), results.get_first_value("--level"));
+}
+
+TEST(parser_test, test_value_views)
+{
+    char app[] { "appname" };
+    char arg1[] { "--level=3" };
+    char arg2[] { "argument1" };
+    char* argv[] = { app, arg1, arg2, nullptr };
+    int argc = 3;
+
+    parser parser;
+    parser.add_valued({ "--level" });
+    parser.add_switch({ "-v" });
+    parser.add_positional("values").set_max_count_unlimited();
+
+    auto results = parser.parse(argument_table(borrow_arguments, argc, argv));
+
+    auto& level_views = results.get_value_views("--level");
+    ASSERT_EQ(std::size_t(1), level_views.size());
+    ASSERT_EQ(&arg1[8], level_views[0].data());
+    ASSERT_EQ(std::string("3"), results.get_first_value("--level"));
+
+    auto& values_views = results.get_value_views("values");
+    ASSERT_EQ(std::size_t(1), values_views.size());
+    ASSERT_EQ(&arg2[0], values_views[0].data());
+
+    ASSERT_TRUE(results.get_value_views("-v").empty());
+}
+
+TEST(parser_test, test_argc_argv_values_outlive_input)
+{
+    parser parser;
+    parser.add_valued({ "--name" });
+
+    results results = parser.parse(argument_table());
+    {
+        std::string app("appname");
+        std::string arg1("--name=value_not_fitting_in_small_string_buffer");
+        const char* argv[] = { app.c_str(), arg1.c_str(), nullptr };
+        results = parser.parse(2, argv);
+    }
+
+    ASSERT_EQ(std::string("value_not_fitting_in_small_string_buffer"), results.get_first_value("--name"));
+}
+
+TEST(parser_test, test_owned_values_outlive_table)
+{
+    parser parser;
+    parser.add_valued({ "--level" }).set_default_value("1");
+    parser.add_positional("values").set_max_count_unlimited();
+
+    std::unique_ptr<argument_table> args(new argument_table("appname", { "argument1", "argument2" }));
+    auto results = parser.parse(*args);
+    args.reset();
+    parser = oct::args::parser();
+
+    ASSERT_EQ(std::string("argument2"), results.get_value_views("values")[1].to_string());
+    ASSERT_EQ(std::string("1"), results.get_value_views("--level")[0].to_string());
+    ASSERT_EQ(std::string("argument1"), results.get_values("values")[0]);
+}
+
 TEST(parser_test, test_custom_type)
 {
     parser parser;
@@ -161,5 +288,34 @@ TEST(parser_test, test_custom_type)
     ASSERT_EQ(format_code::HEX, formats4[3]);
 }
 
+TEST(parser_test, test_converted_values_reused)
+{
+    parser parser;
+    parser.add_valued({ "--format" }).set_type<format_code>().set_convert_function(format_code_converter());
+    parser.add_valued({ "--level" }).set_type<int>().set_convert_function(counting_int_converter());
+    parser.add_valued({ "--count" }).set_type<int>().set_default_value("3");
+    parser.add_valued({ "--untyped" });
+
+    auto results = parser.parse(argument_table("appname", { "--format=hex", "--level", "12", "--untyped=5" }));
+
+    g_counting_converter_calls = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(12, (results.get_first_value_as<int, counting_int_converter>("--level")));
+        ASSERT_EQ(12, (results.get_first_value_as<int, counting_int_converter>("--level", 0)));
+        ASSERT_EQ(std::vector<int>({ 12 }), (results.get_values_as<int, counting_int_converter>("--level")));
+    }
+    ASSERT_EQ(0, g_counting_converter_calls);
+
+    // different converter - value is converted again
+    ASSERT_EQ(12, results.get_first_value_as<int>("--level"));
+    ASSERT_EQ(12L, results.get_first_value_as<long>("--level"));
+
+    ASSERT_EQ(format_code::HEX, (results.get_first_value_as<format_code, format_code_converter>("--format")));
+    ASSERT_EQ(3, results.get_first_value_as<int>("--count"));
+    ASSERT_EQ(5, results.get_first_value_as<int>("--untyped"));
+    ASSERT_EQ(std::string("5"), results.get_first_value_as<std::string>("--untyped"));
+}
+
 } // namespace args
 } // namespace oct
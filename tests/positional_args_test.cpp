@@ -1,5 +1,9 @@
 #include "gtest/gtest.h"
 
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 #include "../include/octargs/octargs.hpp"
 
 namespace oct
@@ -319,7 +323,7 @@ TEST(positional_args_test, test_default_values)
 
     parser parser_single;
     parser_single.add_positional("files").set_default_values({ "one", "two" });
-    ASSERT_THROW(parser_single.parse(args_empty), parser_error);
+    ASSERT_THROW(parser_single.parse(args_empty), invalid_default_value);
 }
 
 TEST(positional_args_test, test_min_max_count)
@@ -378,5 +382,104 @@ TEST(positional_args_test, test_allowed_values)
     ASSERT_THROW(parser.parse(argument_table("app", { "d" })), parser_error);
 }
 
+TEST(positional_args_test, test_values_as_range)
+{
+    parser parser;
+    parser.add_switch({ "-v" });
+    parser.add_positional("FILES").set_max_count_unlimited().set_values_as_range();
+
+    values_range range;
+    {
+        auto results = parser.parse(argument_table("app", { "-v", "a.txt", "b.txt", "c.txt" }));
+        ASSERT_EQ(std::size_t(3), results.get_count("FILES"));
+        ASSERT_EQ(std::string("b.txt"), results.get_values("FILES")[1]);
+        ASSERT_EQ(std::size_t(3), results.get_value_views("FILES").size());
+        ASSERT_EQ(std::string("c.txt"), results.get_value_views("FILES")[2]);
+
+        range = results.get_values_range("FILES");
+    }
+
+    // range keeps results (and arguments table values) alive
+    ASSERT_EQ(std::size_t(3), range.size());
+    std::vector<std::string> values;
+    for (auto& value : range)
+    {
+        values.push_back(value.to_string());
+    }
+    ASSERT_EQ(std::vector<std::string>({ "a.txt", "b.txt", "c.txt" }), values);
+
+    auto empty_results = parser.parse(argument_table("app", { "-v" }));
+    ASSERT_EQ(std::size_t(0), empty_results.get_count("FILES"));
+    ASSERT_TRUE(empty_results.get_values_range("FILES").empty());
+}
+
+TEST(positional_args_test, test_values_as_range_validation)
+{
+    parser parser;
+    parser.add_positional("first");
+    parser.add_positional("rest")
+        .set_min_count(1)
+        .set_max_count(2)
+        .set_allowed_values({ "a", "b" })
+        .set_default_value("a")
+        .set_values_as_range();
+
+    auto results = parser.parse(argument_table("app", { "x", "b", "a" }));
+    ASSERT_EQ(std::string("x"), results.get_first_value("first"));
+    auto range = results.get_values_range("rest");
+    ASSERT_EQ(std::size_t(2), range.size());
+    ASSERT_EQ(std::string("b"), range[0]);
+    ASSERT_EQ(std::string("a"), range.at(1));
+    ASSERT_THROW(range.at(2), std::out_of_range);
+
+    ASSERT_THROW(parser.parse(argument_table("app", { "x", "b", "c" })), parser_error);
+    ASSERT_THROW(parser.parse(argument_table("app", { "x", "b", "a", "b" })), parser_error);
+
+    // default values are used when no values are given
+    auto default_results = parser.parse(argument_table("app", { "x" }));
+    ASSERT_EQ(std::size_t(1), default_results.get_values_range("rest").size());
+    ASSERT_EQ(std::string("a"), default_results.get_values_range("rest")[0]);
+}
+
+TEST(positional_args_test, test_values_as_range_storage)
+{
+    struct settings
+    {
+        std::vector<int> m_numbers;
+    };
+
+    storing_parser<settings> parser;
+    parser.add_positional("NUMBERS")
+        .set_max_count_unlimited()
+        .set_values_as_range()
+        .set_type_and_storage(&settings::m_numbers);
+
+    settings values;
+    auto results = parser.parse(argument_table("app", { "1", "2", "3" }), values);
+    ASSERT_EQ(std::vector<int>({ 1, 2, 3 }), values.m_numbers);
+    ASSERT_EQ(std::vector<int>({ 1, 2, 3 }), results.get_values_as<int>("NUMBERS"));
+
+    ASSERT_THROW(parser.parse(argument_table("app", { "1", "x" }), values), parser_error);
+}
+
+TEST(positional_args_test, test_values_as_range_context)
+{
+    parser parser;
+    parser.add_positional("FILES").set_max_count_unlimited().set_values_as_range();
+
+    const char* argv1[] = { "app", "a", "b" };
+    const char* argv2[] = { "app", "c" };
+
+    parse_context context;
+    auto results1 = parser.parse(3, argv1, context);
+    auto results2 = parser.parse(2, argv2, context);
+
+    // the table reused by context must not change values referenced by earlier results
+    ASSERT_EQ(std::size_t(2), results1.get_values_range("FILES").size());
+    ASSERT_EQ(std::string("b"), results1.get_values_range("FILES")[1]);
+    ASSERT_EQ(std::size_t(1), results2.get_values_range("FILES").size());
+    ASSERT_EQ(std::string("c"), results2.get_values_range("FILES")[0]);
+}
+
 } // namespace args
 } // namespace oct
@@ -0,0 +1,163 @@
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../include/octargs/octargs.hpp"
+#include "../include/octargs/response_file.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+namespace
+{
+
+class temp_file
+{
+public:
+    temp_file(const std::string& name, const std::string& contents)
+        : m_path("octargs_response_file_test_" + name)
+    {
+        std::ofstream stream(m_path, std::ios::out | std::ios::binary | std::ios::trunc);
+        stream.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    ~temp_file()
+    {
+        std::remove(m_path.c_str());
+    }
+
+    const std::string& get_path() const
+    {
+        return m_path;
+    }
+
+    std::string get_argument() const
+    {
+        return "@" + m_path;
+    }
+
+private:
+    std::string m_path;
+};
+
+std::vector<std::string> get_arguments(const argument_table& args)
+{
+    std::vector<std::string> arguments;
+    for (std::size_t i = 0; i < args.get_argument_count(); ++i)
+    {
+        arguments.push_back(args.get_argument(i));
+    }
+    return arguments;
+}
+
+} // namespace
+
+TEST(response_file_test, test_not_expanded_by_default)
+{
+    temp_file file("default", "arg1\n");
+
+    argument_table args("app", { file.get_argument() });
+    ASSERT_EQ(std::vector<std::string>({ file.get_argument() }), get_arguments(args));
+    ASSERT_TRUE(args.get_response_files().empty());
+}
+
+TEST(response_file_test, test_lines)
+{
+    temp_file file("lines", "arg1\n\n--name=value with spaces\r\n  arg3\nlast");
+
+    argument_table args("app", { "first", file.get_argument(), "@", "end" });
+    expand_response_files(args);
+
+    ASSERT_EQ(std::vector<std::string>({ "first", "arg1", "--name=value with spaces", "  arg3", "last", "@", "end" }),
+        get_arguments(args));
+    ASSERT_EQ(std::size_t(1), args.get_response_files().size());
+}
+
+TEST(response_file_test, test_nul_separated)
+{
+    temp_file file("nul", std::string("arg1\0line\nbreak\0\0arg3\0", 23));
+
+    argument_table args("app", { file.get_argument() });
+    expand_response_files(args);
+
+    ASSERT_EQ(std::vector<std::string>({ "arg1", "line\nbreak", "arg3" }), get_arguments(args));
+}
+
+TEST(response_file_test, test_empty_file)
+{
+    temp_file file("empty", "");
+
+    argument_table args("app", { "a", file.get_argument(), "b" });
+    expand_response_files(args);
+
+    ASSERT_EQ(std::vector<std::string>({ "a", "b" }), get_arguments(args));
+}
+
+TEST(response_file_test, test_nested)
+{
+    temp_file inner("inner", "inner1\ninner2\n");
+    temp_file outer("outer", "outer1\n" + inner.get_argument() + "\nouter2\n" + inner.get_argument() + "\n");
+
+    argument_table args("app", { outer.get_argument(), "end" });
+    expand_response_files(args);
+
+    ASSERT_EQ(std::vector<std::string>({ "outer1", "inner1", "inner2", "outer2", "inner1", "inner2", "end" }),
+        get_arguments(args));
+
+    argument_table args_limited("app", { outer.get_argument() });
+    ASSERT_THROW(expand_response_files(args_limited, 1), response_file_error);
+}
+
+TEST(response_file_test, test_errors)
+{
+    temp_file self("self", "arg1\n@octargs_response_file_test_self\n");
+
+    argument_table args_self("app", { self.get_argument() });
+    try
+    {
+        expand_response_files(args_self);
+        ASSERT_TRUE(false);
+    }
+    catch (const response_file_error_ex<char>& exc)
+    {
+        ASSERT_EQ(self.get_path(), exc.get_path());
+    }
+
+    argument_table args_missing("app", { "@octargs_response_file_test_missing" });
+    ASSERT_THROW(expand_response_files(args_missing), response_file_error);
+}
+
+TEST(response_file_test, test_parse)
+{
+    parser parser;
+    parser.add_switch({ "-v" });
+    parser.add_valued({ "--level" });
+    parser.add_positional("FILES").set_max_count_unlimited();
+
+    std::string contents = "--level\n7\n";
+    for (int i = 0; i < 1000; ++i)
+    {
+        contents += "file" + std::to_string(i) + ".cpp\n";
+    }
+    temp_file file("parse", contents);
+
+    std::unique_ptr<argument_table> args(new argument_table("app", { "-v", file.get_argument() }));
+    expand_response_files(*args);
+
+    auto results = parser.parse(*args);
+    args.reset();
+
+    ASSERT_TRUE(results.has_value("-v"));
+    ASSERT_EQ(7, results.get_first_value_as<int>("--level"));
+    ASSERT_EQ(std::size_t(1000), results.get_count("FILES"));
+    ASSERT_EQ(std::string("file999.cpp"), results.get_value_views("FILES")[999].to_string());
+}
+
+} // namespace args
+} // namespace oct
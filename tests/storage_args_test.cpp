@@ -287,6 +287,86 @@ TEST(storage_args_test, test_store_function)
     ASSERT_EQ(double(-17.43), my_double);
 }
 
+TEST(storage_args_test, test_default_values_converted_once)
+{
+    argument_table args_empty("appname", {});
+
+    struct settings
+    {
+        int m_level;
+        std::vector<int> m_values;
+    };
+
+    int convert_count = 0;
+
+    storing_parser<settings> parser;
+    parser.add_valued({ "--level" })
+        .set_type_and_storage(&settings::m_level)
+        .set_convert_function([&convert_count](const std::string& value_str) {
+            ++convert_count;
+            return std::stoi(value_str);
+        })
+        .set_default_value("5");
+    parser.add_positional("values")
+        .set_max_count_unlimited()
+        .set_type_and_storage(&settings::m_values)
+        .set_default_values({ "1", "2" });
+
+    for (int i = 0; i < 3; ++i)
+    {
+        settings settings1 { 0, {} };
+        auto results = parser.parse(args_empty, settings1);
+        ASSERT_EQ(5, settings1.m_level);
+        ASSERT_EQ(std::vector<int>({ 1, 2 }), settings1.m_values);
+        ASSERT_EQ(std::size_t(2), results.get_count("values"));
+    }
+    ASSERT_EQ(1, convert_count);
+}
+
+TEST(storage_args_test, test_storage_replaced)
+{
+    argument_table args1("appname",
+        {
+            "--int=7",
+            "--int=8",
+        });
+
+    struct settings
+    {
+        int m_int;
+        std::vector<int> m_ints;
+    };
+    int my_int = 0;
+
+    storing_parser<settings> parser;
+    auto arg = parser.add_valued({ "--int" }).set_max_count_unlimited().set_type_and_storage(&settings::m_int);
+
+    settings settings1 = {};
+    parser.parse(args1, settings1);
+    ASSERT_EQ(8, settings1.m_int);
+
+    arg.set_storage(&settings::m_ints);
+
+    settings settings2 = {};
+    parser.parse(args1, settings2);
+    ASSERT_EQ(0, settings2.m_int);
+    ASSERT_EQ(std::vector<int>({ 7, 8 }), settings2.m_ints);
+
+    arg.set_store_function([&my_int](int value) { my_int += value; });
+
+    settings settings3 = {};
+    parser.parse(args1, settings3);
+    ASSERT_EQ(15, my_int);
+    ASSERT_TRUE(settings3.m_ints.empty());
+
+    arg.set_storage(&settings::m_int);
+
+    settings settings4 = {};
+    parser.parse(args1, settings4);
+    ASSERT_EQ(15, my_int);
+    ASSERT_EQ(8, settings4.m_int);
+}
+
 template <typename parser_T>
 void check_parse_exception(parser_T& parser, const argument_table& args, parser_error_code code,
     const std::string& arg_name, const std::string& value_str)
@@ -0,0 +1,77 @@
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+
+#include "../include/octargs/string_view.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+namespace
+{
+
+using string_view = basic_string_view<char>;
+
+} // namespace
+
+TEST(string_view_test, test_construction)
+{
+    string_view empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(std::size_t(0), empty.size());
+
+    const char* c_str = "value";
+    string_view from_c_str(c_str);
+    ASSERT_EQ(c_str, from_c_str.data());
+    ASSERT_EQ(std::size_t(5), from_c_str.size());
+
+    std::string str("value");
+    string_view from_str(str);
+    ASSERT_EQ(str.data(), from_str.data());
+    ASSERT_EQ(str.size(), from_str.size());
+    ASSERT_EQ(str, from_str.to_string());
+}
+
+TEST(string_view_test, test_compare)
+{
+    string_view view("--name");
+
+    ASSERT_TRUE(view == std::string("--name"));
+    ASSERT_TRUE(std::string("--name") == view);
+    ASSERT_TRUE(view == "--name");
+    ASSERT_TRUE(view != "--nam");
+    ASSERT_TRUE(view != "--names");
+    ASSERT_TRUE(string_view("--a") < string_view("--b"));
+    ASSERT_TRUE(string_view("--a") < string_view("--ab"));
+    ASSERT_FALSE(string_view("--ab") < string_view("--a"));
+}
+
+TEST(string_view_test, test_find_substr)
+{
+    string_view view("--name=value");
+
+    auto pos = view.find("=");
+    ASSERT_EQ(std::size_t(6), pos);
+    ASSERT_EQ(std::string("--name"), view.substr(0, pos).to_string());
+    ASSERT_EQ(std::string("value"), view.substr(pos + 1).to_string());
+    ASSERT_EQ(view.data() + pos + 1, view.substr(pos + 1).data());
+
+    ASSERT_EQ(string_view::npos, view.find(":"));
+    ASSERT_EQ(string_view::npos, view.find("=", pos + 1));
+    ASSERT_EQ(std::size_t(0), view.find(""));
+    ASSERT_TRUE(view.substr(view.size()).empty());
+    ASSERT_THROW(view.substr(view.size() + 1), std::out_of_range);
+}
+
+TEST(string_view_test, test_output)
+{
+    std::ostringstream os;
+    os << string_view("--name=value").substr(2, 4);
+    ASSERT_EQ(std::string("name"), os.str());
+}
+
+} // namespace args
+} // namespace oct
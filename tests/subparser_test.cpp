@@ -150,5 +150,24 @@ TEST(subparser_test, test_errors)
     ASSERT_THROW(parser3.parse(args2), parser_error);
 }
 
+TEST(subparser_test, test_empty_name_without_subparsers)
+{
+    parser parser;
+    parser.add_subparsers("cmd");
+
+    try
+    {
+        parser.parse(argument_table("appname", { "", "x" }));
+        FAIL() << "Exception not thrown";
+    }
+    catch (const parser_error_ex<char>& exc)
+    {
+        ASSERT_TRUE(exc.get_error_code() == parser_error_code::SUBPARSER_NOT_FOUND);
+    }
+
+    auto results = oct::args::parser().parse(argument_table("appname", {}));
+    ASSERT_THROW(results.get_count(""), unknown_argument);
+}
+
 } // namespace args
 } // namespace oct
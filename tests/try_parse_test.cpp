@@ -0,0 +1,152 @@
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <string>
+
+#include "../include/octargs/octargs.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+namespace
+{
+
+struct even_converter
+{
+    int operator()(const std::string& value_str) const
+    {
+        auto value = std::stoi(value_str);
+        if (value % 2 != 0)
+        {
+            throw conversion_error_ex<char>(value_str);
+        }
+        return value;
+    }
+};
+
+parser make_parser()
+{
+    parser parser;
+    parser.add_switch({ "-v", "--verbose" });
+    parser.add_valued({ "-l", "--level" }).set_allowed_values({ "low", "high" });
+    parser.add_valued({ "-j", "--jobs" }).set_type<int>();
+    parser.add_valued({ "--even" }).set_type<int>().set_convert_function(even_converter());
+    parser.add_positional("FILE").set_min_count(1);
+    return parser;
+}
+
+void check_error(const parse_result& result, parser_error_code code, std::size_t index, const std::string& name,
+    const std::string& value)
+{
+    ASSERT_FALSE(result);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_TRUE(result.get_error_code() == code);
+    EXPECT_EQ(index, result.get_error_index());
+    EXPECT_EQ(name, result.get_error_name().to_string());
+    EXPECT_EQ(value, result.get_error_value().to_string());
+}
+
+} // namespace
+
+TEST(try_parse_test, test_success)
+{
+    auto parser = make_parser();
+
+    auto result = parser.try_parse(argument_table("app", { "-v", "--jobs=4", "file.txt" }));
+    ASSERT_TRUE(result);
+    ASSERT_FALSE(result.has_error());
+
+    auto& results = result.get_results();
+    EXPECT_EQ(std::size_t(1), results.get_count("-v"));
+    EXPECT_EQ(4, results.get_first_value_as<int>("-j"));
+    EXPECT_EQ(std::string("file.txt"), results.get_first_value("FILE"));
+}
+
+TEST(try_parse_test, test_errors)
+{
+    auto parser = make_parser();
+
+    check_error(parser.try_parse(argument_table("app", { "-l", "mid", "file.txt" })),
+        parser_error_code::VALUE_NOT_ALLOWED, 1, "-l", "mid");
+    check_error(parser.try_parse(argument_table("app", { "-l=low", "--level=high", "file.txt" })),
+        parser_error_code::TOO_MANY_OCCURRENCES, 1, "--level", "high");
+    check_error(parser.try_parse(argument_table("app", { "--jobs" })), parser_error_code::VALUE_MISSING, 0, "--jobs",
+        "");
+    check_error(parser.try_parse(argument_table("app", { "-v=yes", "file.txt" })), parser_error_code::UNEXPECTED_VALUE,
+        0, "-v", "yes");
+    check_error(parser.try_parse(argument_table("app", { "-v" })), parser_error_code::REQUIRED_ARGUMENT_MISSING,
+        parse_result::NO_INDEX, "FILE", "");
+    check_error(parser.try_parse(argument_table("app", { "file1.txt", "file2.txt" })), parser_error_code::SYNTAX_ERROR,
+        1, "", "file2.txt");
+    check_error(parser.try_parse(argument_table("app", { "-v", "-j", "four", "file.txt" })),
+        parser_error_code::CONVERSION_FAILED, 2, "-j", "four");
+    check_error(parser.try_parse(argument_table("app", { "--even=3", "file.txt" })),
+        parser_error_code::CONVERSION_FAILED, 0, "--even", "3");
+
+    auto result = parser.try_parse(argument_table("app", {}));
+    ASSERT_THROW(result.get_results(), std::logic_error);
+}
+
+TEST(try_parse_test, test_subparsers)
+{
+    parser parser;
+    auto subparsers = parser.add_subparsers("command");
+    subparsers.add_parser("add").add_positional("values").set_max_count_unlimited().set_type<int>();
+
+    check_error(parser.try_parse(argument_table("app", {})), parser_error_code::SUBPARSER_NAME_MISSING,
+        parse_result::NO_INDEX, "command", "");
+    check_error(
+        parser.try_parse(argument_table("app", { "mul" })), parser_error_code::SUBPARSER_NOT_FOUND, 0, "command", "");
+    check_error(parser.try_parse(argument_table("app", { "add", "1", "x" })), parser_error_code::CONVERSION_FAILED, 2,
+        "values", "x");
+
+    auto result = parser.try_parse(argument_table("app", { "add", "1", "2" }));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::size_t(2), result.get_results().get_count("add values"));
+}
+
+TEST(try_parse_test, test_storing_and_compiled)
+{
+    struct settings
+    {
+        int m_level;
+    };
+
+    storing_parser<settings> parser;
+    parser.add_valued({ "--level" }).set_type_and_storage(&settings::m_level);
+
+    settings values;
+    values.m_level = 0;
+
+    parse_context context;
+    auto result = parser.try_parse(argument_table("app", { "--level=5" }), values, context);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(5, values.m_level);
+
+    auto compiled = parser.compile();
+    check_error(compiled.try_parse(argument_table("app", { "--level=x" }), values), parser_error_code::CONVERSION_FAILED,
+        0, "--level", "x");
+    EXPECT_EQ(5, values.m_level);
+}
+
+TEST(try_parse_test, test_parse_nested_exception)
+{
+    auto parser = make_parser();
+
+    try
+    {
+        parser.parse(argument_table("app", { "--even=3", "file.txt" }));
+        FAIL() << "Exception not thrown";
+    }
+    catch (const parser_error_ex<char>& exc)
+    {
+        EXPECT_TRUE(exc.get_error_code() == parser_error_code::CONVERSION_FAILED);
+        EXPECT_EQ(std::string("--even"), exc.get_name());
+        EXPECT_THROW(std::rethrow_if_nested(exc), conversion_error);
+    }
+}
+
+} // namespace args
+} // namespace oct
@@ -0,0 +1,138 @@
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../include/octargs/internal/typed_value.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+namespace
+{
+
+struct big_value
+{
+    explicit big_value(int value)
+        : m_value(value)
+        , m_padding()
+    {
+        // noop
+    }
+
+    int m_value;
+    char m_padding[128];
+};
+
+class counting_value
+{
+public:
+    explicit counting_value(std::shared_ptr<int> counter)
+        : m_counter(counter)
+    {
+        // noop
+    }
+
+    std::shared_ptr<int> m_counter;
+};
+
+} // namespace
+
+TEST(typed_value_test, test_empty)
+{
+    internal::typed_value value;
+
+    ASSERT_TRUE(value.empty());
+    ASSERT_TRUE(value.get_tag() == nullptr);
+    ASSERT_TRUE(value.get<int>() == nullptr);
+}
+
+TEST(typed_value_test, test_small_value)
+{
+    internal::typed_value value;
+    value.emplace(internal::get_type_id<double>(), 7);
+
+    ASSERT_FALSE(value.empty());
+    ASSERT_TRUE(value.get_tag() == internal::get_type_id<double>());
+    ASSERT_TRUE(value.get<long>() == nullptr);
+    ASSERT_TRUE(value.get<int>() != nullptr);
+    ASSERT_EQ(7, *value.get<int>());
+
+    value.emplace(nullptr, std::string("text"));
+    ASSERT_TRUE(value.get_tag() == nullptr);
+    ASSERT_TRUE(value.get<int>() == nullptr);
+    ASSERT_EQ(std::string("text"), *value.get<std::string>());
+
+    value.reset();
+    ASSERT_TRUE(value.empty());
+}
+
+TEST(typed_value_test, test_same_layout_types)
+{
+    // types with identical handler functions still have distinct identifiers and operations
+    ASSERT_TRUE(internal::get_type_id<int>() != internal::get_type_id<unsigned>());
+    ASSERT_TRUE(internal::get_type_id<int>() == internal::get_type_id<const int&>());
+
+    internal::typed_value value;
+    value.emplace(internal::get_type_id<int>(), 3);
+
+    ASSERT_TRUE(value.get<unsigned>() == nullptr);
+    ASSERT_TRUE(value.get<float>() == nullptr);
+    ASSERT_EQ(3, *value.get<int>());
+
+    value.emplace(internal::get_type_id<unsigned>(), 4u);
+    ASSERT_TRUE(value.get<int>() == nullptr);
+    ASSERT_EQ(4u, *value.get<unsigned>());
+}
+
+TEST(typed_value_test, test_big_value)
+{
+    internal::typed_value value;
+    value.emplace(nullptr, big_value(5));
+
+    ASSERT_EQ(5, value.get<big_value>()->m_value);
+
+    internal::typed_value copy(value);
+    ASSERT_EQ(5, copy.get<big_value>()->m_value);
+    ASSERT_NE(value.get<big_value>(), copy.get<big_value>());
+
+    auto value_ptr = value.get<big_value>();
+    internal::typed_value moved(std::move(value));
+    ASSERT_TRUE(value.empty());
+    ASSERT_EQ(value_ptr, moved.get<big_value>());
+}
+
+TEST(typed_value_test, test_copy_move_destroy)
+{
+    auto counter = std::make_shared<int>(0);
+
+    {
+        std::vector<internal::typed_value> values;
+        for (int i = 0; i < 10; ++i)
+        {
+            values.emplace_back();
+            values.back().emplace(nullptr, counting_value(counter));
+        }
+        ASSERT_EQ(11, counter.use_count());
+
+        auto copy = values;
+        ASSERT_EQ(21, counter.use_count());
+
+        internal::typed_value value;
+        value = copy[0];
+        ASSERT_EQ(22, counter.use_count());
+        value = std::move(copy[1]);
+        ASSERT_EQ(21, counter.use_count());
+        ASSERT_TRUE(copy[1].empty());
+        ASSERT_TRUE(value.get<counting_value>()->m_counter == counter);
+    }
+
+    ASSERT_EQ(1, counter.use_count());
+}
+
+} // namespace args
+} // namespace oct
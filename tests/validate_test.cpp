@@ -0,0 +1,206 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+#include "../include/octargs/octargs.hpp"
+
+#include "allocation_counter.hpp"
+#include "helpers.hpp"
+
+namespace oct
+{
+namespace args
+{
+
+using test::settings;
+
+namespace
+{
+
+parser make_parser()
+{
+    parser parser;
+    parser.add_exclusive({ "--help" });
+    parser.add_switch({ "-v", "--verbose" });
+    parser.add_valued({ "-l", "--level" }).set_allowed_values({ "low", "high" });
+    parser.add_valued({ "-j", "--jobs" }).set_type<int>().set_default_value("1");
+    parser.add_positional("FILE").set_min_count(1);
+    return parser;
+}
+
+void check_error(const validation_result& result, parser_error_code code, std::size_t index,
+    const std::string& name, const std::string& value)
+{
+    ASSERT_FALSE(result);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_TRUE(result.get_error_code() == code);
+    EXPECT_EQ(index, result.get_error_index());
+    EXPECT_EQ(name, result.get_error_name().to_string());
+    EXPECT_EQ(value, result.get_error_value().to_string());
+}
+
+} // namespace
+
+TEST(validate_test, test_valid)
+{
+    auto parser = make_parser();
+
+    auto result = parser.validate(argument_table("app", { "-v", "--jobs=4", "-l", "low", "file.txt" }));
+    ASSERT_TRUE(result);
+    EXPECT_FALSE(result.has_error());
+    EXPECT_EQ(validation_result::NO_INDEX, result.get_error_index());
+
+    EXPECT_TRUE(parser.validate(argument_table("app", { "--help" })));
+}
+
+TEST(validate_test, test_errors)
+{
+    auto parser = make_parser();
+
+    check_error(parser.validate(argument_table("app", { "-l", "mid", "file.txt" })),
+        parser_error_code::VALUE_NOT_ALLOWED, 1, "-l", "mid");
+    check_error(parser.validate(argument_table("app", { "-l=low", "--level=high", "file.txt" })),
+        parser_error_code::TOO_MANY_OCCURRENCES, 1, "--level", "high");
+    check_error(parser.validate(argument_table("app", { "--jobs" })), parser_error_code::VALUE_MISSING, 0, "--jobs",
+        "");
+    check_error(parser.validate(argument_table("app", { "-v" })), parser_error_code::REQUIRED_ARGUMENT_MISSING,
+        validation_result::NO_INDEX, "FILE", "");
+    check_error(parser.validate(argument_table("app", { "file1.txt", "file2.txt" })), parser_error_code::SYNTAX_ERROR,
+        1, "", "file2.txt");
+    check_error(parser.validate(argument_table("app", { "-v", "-j", "four", "file.txt" })),
+        parser_error_code::CONVERSION_FAILED, 2, "-j", "four");
+    // exclusive argument is accepted only alone
+    check_error(parser.validate(argument_table("app", { "--help", "file.txt" })), parser_error_code::SYNTAX_ERROR, 1,
+        "", "file.txt");
+}
+
+TEST(validate_test, test_subparsers)
+{
+    parser parser;
+    auto subparsers = parser.add_subparsers("command");
+    subparsers.add_parser("add").add_positional("values").set_max_count_unlimited().set_type<int>();
+
+    check_error(parser.validate(argument_table("app", {})), parser_error_code::SUBPARSER_NAME_MISSING,
+        validation_result::NO_INDEX, "command", "");
+    check_error(
+        parser.validate(argument_table("app", { "mul" })), parser_error_code::SUBPARSER_NOT_FOUND, 0, "command", "");
+    check_error(parser.validate(argument_table("app", { "add", "1", "x" })), parser_error_code::CONVERSION_FAILED, 2,
+        "values", "x");
+
+    EXPECT_TRUE(parser.validate(argument_table("app", { "add", "1", "2" })));
+}
+
+TEST(validate_test, test_storage_not_used)
+{
+    storing_parser<settings> parser;
+    parser.add_switch({ "-v" }).set_type_and_storage(&settings::m_verbose);
+    parser.add_valued({ "--level" }).set_type_and_storage(&settings::m_level).set_default_value("3");
+    parser.add_positional("FILES").set_type_and_storage(&settings::m_files).set_max_count_unlimited();
+
+    std::size_t check_count = 0;
+    parser.add_valued({ "--checked" }).set_type<int>().set_check_function([&check_count](int value) {
+        ++check_count;
+        if (value < 0)
+        {
+            throw conversion_error_ex<char>(std::to_string(value));
+        }
+    });
+
+    EXPECT_TRUE(parser.validate(argument_table("app", { "-v", "--checked=1", "a", "b" })));
+    EXPECT_EQ(1, check_count);
+
+    check_error(parser.validate(argument_table("app", { "--checked=-1" })), parser_error_code::CONVERSION_FAILED, 0,
+        "--checked", "-1");
+    EXPECT_EQ(2, check_count);
+
+    auto compiled = parser.compile();
+    EXPECT_TRUE(compiled.validate(argument_table("app", { "-v", "--level=5", "a" })));
+    check_error(compiled.validate(argument_table("app", { "--level=x" })), parser_error_code::CONVERSION_FAILED, 0,
+        "--level", "x");
+
+    settings values;
+    parser.parse(argument_table("app", { "a" }), values);
+    EXPECT_FALSE(values.m_verbose);
+    EXPECT_EQ(3, values.m_level);
+    EXPECT_EQ(std::vector<std::string>({ "a" }), values.m_files);
+}
+
+TEST(validate_test, test_store_functions_not_called)
+{
+    std::size_t store_count = 0;
+    auto store_function = [&store_count](int /*value*/) { ++store_count; };
+
+    parser parser;
+    parser.add_valued({ "--level" }).set_type<int>().set_store_function(store_function);
+    parser.add_valued({ "--jobs" }).set_type<int>().set_default_value("2").set_store_function(store_function);
+
+    EXPECT_TRUE(parser.validate(argument_table("app", { "--level=5" })));
+    EXPECT_EQ(0, store_count);
+
+    parser.parse(argument_table("app", { "--level=5" }));
+    EXPECT_EQ(2, store_count);
+}
+
+TEST(validate_test, test_no_allocations)
+{
+    auto parser = make_parser();
+
+    argument_table arg_table("app", { "-v", "--jobs=4", "-l", "low", "file.txt" });
+
+    // first call builds the parser snapshot
+    ASSERT_TRUE(parser.validate(arg_table));
+
+    auto allocation_count = g_allocation_count.load();
+    ASSERT_TRUE(parser.validate(arg_table));
+    EXPECT_EQ(allocation_count, g_allocation_count.load());
+
+    auto compiled = parser.compile();
+    allocation_count = g_allocation_count.load();
+    ASSERT_TRUE(compiled.validate(arg_table));
+    EXPECT_EQ(allocation_count, g_allocation_count.load());
+}
+
+TEST(validate_test, test_no_allocations_many_arguments)
+{
+    parser parser;
+    std::vector<std::string> args;
+    for (int i = 0; i < 100; ++i)
+    {
+        auto name = "--switch" + std::to_string(i);
+        parser.add_switch({ name });
+        args.push_back(name);
+    }
+    parser.add_valued({ "--count" }).set_type<int>();
+    args.push_back("--count=00000000000000000000000000000042");
+
+    argument_table arg_table("app", args);
+
+    // first call builds the parser snapshot and the counters buffer
+    ASSERT_TRUE(parser.validate(arg_table));
+
+    auto allocation_count = g_allocation_count.load();
+    ASSERT_TRUE(parser.validate(arg_table));
+    EXPECT_EQ(allocation_count, g_allocation_count.load());
+}
+
+TEST(validate_test, test_many_arguments)
+{
+    parser parser;
+    std::vector<std::string> args;
+    for (int i = 0; i < 100; ++i)
+    {
+        auto name = "--switch" + std::to_string(i);
+        parser.add_switch({ name });
+        args.push_back(name);
+    }
+
+    EXPECT_TRUE(parser.validate(argument_table("app", args)));
+
+    args.push_back("--switch0");
+    check_error(parser.validate(argument_table("app", args)), parser_error_code::TOO_MANY_OCCURRENCES, 100,
+        "--switch0", "true");
+}
+
+} // namespace args
+} // namespace oct
@@ -272,7 +272,7 @@ TEST(valued_args_test, test_default_values)
     ASSERT_EQ(std::string("two"), results.get_values("-v")[1]);
 
     arg.set_default_values({ "one", "two", "three", "four" });
-    ASSERT_THROW(parser.parse(args_empty), parser_error);
+    ASSERT_THROW(parser.parse(args_empty), invalid_default_value);
 
     arg.set_default_values({ "one", "two", "three" });
     results = parser.parse(args_empty);
@@ -291,6 +291,92 @@ TEST(valued_args_test, test_default_values)
     ASSERT_EQ(std::size_t(0), results.get_count("-v"));
 }
 
+TEST(valued_args_test, test_invalid_default_values)
+{
+    argument_table args_empty("appname", {});
+
+    parser parser1;
+    parser1.add_valued({ "--level" }).set_type<int>().set_default_value("high");
+    ASSERT_THROW(parser1.compile(), invalid_default_value);
+
+    parser parser2;
+    parser2.add_valued({ "--mode" }).set_allowed_values({ "fast", "slow" }).set_default_value("medium");
+    try
+    {
+        parser2.parse(args_empty);
+        FAIL();
+    }
+    catch (const invalid_default_value_ex<char>& exc)
+    {
+        ASSERT_EQ(std::string("--mode"), exc.get_name());
+        ASSERT_EQ(std::string("medium"), exc.get_value());
+    }
+}
+
+TEST(valued_args_test, test_default_value_handler_replaced)
+{
+    argument_table args_empty("appname", {});
+
+    int stored_value = 0;
+
+    parser parser;
+    auto arg = parser.add_valued({ "--level" })
+                   .set_type<int>()
+                   .set_default_value("7")
+                   .set_store_function([&stored_value](int value) { stored_value = value; });
+
+    parser.parse(args_empty);
+    ASSERT_EQ(7, stored_value);
+
+    arg.set_convert_function([](const std::string& value_str) { return std::stoi(value_str) * 2; });
+
+    parser.parse(args_empty);
+    ASSERT_EQ(14, stored_value);
+}
+
+TEST(valued_args_test, test_max_count_changed_after_parse)
+{
+    argument_table args_empty("appname", {});
+
+    parser parser;
+    auto arg = parser.add_valued({ "--level" }).set_max_count(2).set_default_values({ "1", "2" });
+
+    ASSERT_EQ(std::size_t(2), parser.parse(args_empty).get_count("--level"));
+
+    arg.set_max_count(1);
+    ASSERT_THROW(parser.parse(args_empty), invalid_default_value);
+}
+
+TEST(valued_args_test, test_default_values_changed_after_compile)
+{
+    argument_table args_empty("appname", {});
+
+    parser parser;
+    auto arg = parser.add_valued({ "--level" }).set_type<int>().set_default_value("1");
+
+    auto compiled = parser.compile();
+    arg.set_max_count_unlimited().set_default_values({ "2", "3", "4" });
+
+    auto results = compiled.parse(args_empty);
+    ASSERT_EQ(std::size_t(1), results.get_count("--level"));
+    ASSERT_EQ(1, results.get_first_value_as<int>("--level"));
+}
+
+TEST(valued_args_test, test_default_values_changed_after_parse)
+{
+    argument_table args_empty("appname", {});
+
+    parser parser;
+    auto arg = parser.add_valued({ "--name" }).set_default_value("default_value_not_fitting_in_sso");
+
+    auto results = parser.parse(args_empty);
+    arg.set_default_value("other_value_not_fitting_in_sso");
+
+    ASSERT_EQ(std::string("default_value_not_fitting_in_sso"), results.get_value_views("--name")[0].to_string());
+    ASSERT_EQ(std::string("default_value_not_fitting_in_sso"), results.get_first_value("--name"));
+    ASSERT_EQ(std::string("other_value_not_fitting_in_sso"), parser.parse(args_empty).get_first_value("--name"));
+}
+
 TEST(valued_args_test, test_min_max_count)
 {
     argument_table args("appname", { "-v", "value1", "-v", "value2" });
@@ -336,5 +422,25 @@ TEST(valued_args_test, test_allowed_values)
     ASSERT_THROW(parser.parse(argument_table("app", { "-v", "d" })), parser_error);
 }
 
+TEST(valued_args_test, test_allowed_values_many)
+{
+    std::vector<std::string> regions;
+    for (int i = 0; i < 500; ++i)
+    {
+        regions.push_back("region-" + std::to_string(i));
+    }
+
+    parser parser;
+    parser.add_valued({ "--region" }).set_max_count(2).set_allowed_values({ "none" }).set_allowed_values(regions);
+
+    auto results = parser.parse(argument_table("app", { "--region", "region-0", "--region=region-499" }));
+    ASSERT_EQ(std::size_t(2), results.get_count("--region"));
+    ASSERT_EQ(std::string("region-499"), results.get_values("--region")[1]);
+
+    ASSERT_THROW(parser.parse(argument_table("app", { "--region", "none" })), parser_error);
+    ASSERT_THROW(parser.parse(argument_table("app", { "--region", "region-500" })), parser_error);
+    ASSERT_THROW(parser.parse(argument_table("app", { "--region", "REGION-1" })), parser_error);
+}
+
 } // namespace args
 } // namespace oct